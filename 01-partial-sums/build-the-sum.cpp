@@ -1,5 +1,5 @@
 /*
-Just sum of addends.
+Just sum of addends, kept in 64 bits.
 */
 
 #include <iostream>
@@ -7,19 +7,21 @@ Just sum of addends.
 using namespace std;
 
 void solve() {
-  int addends_nr, sum = 0, addend;
+  int addends_nr, addend;
+  long sum = 0;
   cin >> addends_nr;
   for (int i = 0; i < addends_nr; i++) {
     cin >> addend;
     sum += addend;
   }
-  cout << sum << endl;
+  cout << sum << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
@@ -25,11 +25,12 @@ void solve() {
     prev--;
     if (curr > prev) prev = curr;
   }
-  cout << falling_dominoes << endl;
+  cout << falling_dominoes << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
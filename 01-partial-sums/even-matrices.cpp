@@ -1,9 +1,20 @@
 /*
 Reducing the 2D problem to a 1D problem equal to Even Pairs.
 Partial sums of precomputed values.
+
+Only the parity of the partial sums matters, so row i of the prefix matrix is
+stored as bits: bit j is the parity of the submatrix (1..i, 1..j). For the rows
+i1..i2, column j has an odd partial sum exactly when bit j differs between
+the prefix rows i2 and i1 - 1, so one XOR and popcount per 64 columns counts
+the odd partial sums. The i1 rows are independent and split across threads for
+large matrices.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 using namespace std;
@@ -11,47 +22,60 @@ using namespace std;
 void solve() {
   int n;
   cin >> n;
-  n++;
-  vector<vector<int>> m(n, vector<int>(n));
-
-  for (int i = 1; i < n; i++)
-    for (int j = 1; j < n; j++) cin >> m[i][j];
-
-  // matrix holding the number of ones in a submatrix
-  vector<vector<int>> pre(n, vector<int>(n));
-  for (int i = 1; i < n; i++)
-    for (int j = 1; j < n; j++)
-      pre[i][j] = m[i][j] + pre[i - 1][j] + pre[i][j - 1] - pre[i - 1][j - 1];
-
-  int even = 0;
-  for (int i1 = 1; i1 < n; i1++) {
-    for (int i2 = i1; i2 < n; i2++) {
-      vector<int> s(n);        // even pairs on s
-      vector<int> partial(n);  // partials sums of s
-      for (int j = 1; j <= n; j++) {
-        s[j] =
-            pre[i2][j] - pre[i2][j - 1] - pre[i1 - 1][j] + pre[i1 - 1][j - 1];
-        partial[j] = partial[j - 1] + s[j];
-      }
-
-      int i_even = 0, i_odd = 0;
-      for (int j = 1; j < n; j++) {
-        if (partial[j] % 2 == 0)
-          i_even++;
-        else
-          i_odd++;
-      }
+  const int nr_words = (n + 63) / 64;
 
-      even += i_even * (i_even - 1) / 2 + i_odd * (i_odd - 1) / 2 + i_even;
+  // parity prefix rows, row 0 is all zeros
+  vector<uint64_t> pre((n + 1) * nr_words, 0);
+  for (int i = 1; i <= n; i++) {
+    uint64_t *row = &pre[i * nr_words];
+    const uint64_t *above = &pre[(i - 1) * nr_words];
+    int row_parity = 0;  // parity of m[i][1..j]
+    for (int j = 0; j < n; j++) {
+      int x;
+      cin >> x;
+      row_parity ^= x & 1;
+      row[j / 64] |= (uint64_t)row_parity << (j % 64);
     }
+    for (int w = 0; w < nr_words; w++) row[w] ^= above[w];
   }
-  cout << even << endl;
+
+  auto count_from = [&](int i1) {
+    long even = 0;
+    const uint64_t *top = &pre[(i1 - 1) * nr_words];
+    for (int i2 = i1; i2 <= n; i2++) {
+      const uint64_t *bottom = &pre[i2 * nr_words];
+      long i_odd = 0;
+      for (int w = 0; w < nr_words; w++)
+        i_odd += __builtin_popcountll(top[w] ^ bottom[w]);
+      long i_even = n - i_odd;
+      even += i_even * (i_even - 1) / 2 + i_odd * (i_odd - 1) / 2 + i_even;
+    }
+    return even;
+  };
+
+  // top rows are claimed from an atomic counter, each thread sums its own share
+  atomic<long> even(0);
+  atomic<int> next_row(1);
+  auto worker = [&]() {
+    long local = 0;
+    for (int i1 = next_row++; i1 <= n; i1 = next_row++) local += count_from(i1);
+    even += local;
+  };
+
+  int nr_threads = max(1, min((int)thread::hardware_concurrency(), n / 512));
+  vector<thread> pool;
+  for (int i = 1; i < nr_threads; i++) pool.emplace_back(worker);
+  worker();
+  for (auto &th : pool) th.join();
+
+  cout << even << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
@@ -1,38 +1,77 @@
 /*
 Calculate number of even and odd sequences from 0...n,
 then calculate number of even combinations for all pairs of i...j.
+
+Only the parity of the current prefix and the two counters are needed, so the
+input is streamed in chunks of bits packed into 64-bit words. Within a word the
+prefix parities are a prefix-XOR (a shift-xor cascade), so the odd prefixes of
+a whole word are counted with one popcount. The answer for everything read so
+far is available after every chunk. The counters are 64-bit since the number
+of pairs grows quadratically.
 */
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <vector>
 
 using namespace std;
 
-void solve() {
-  int n, t;
-  cin >> n;
+class even_pairs {
   bool is_even = true;
-  int even = 0, odd = 0;  // number of even and odd S_i
+  long even = 0, odd = 0;  // number of even and odd S_i
 
-  for (int i = 0; i < n; i++) {
-    cin >> t;
-    if (t == 1) is_even = !is_even;
+ public:
+  // x_i is bit i % 64 of words[i / 64], for i < nr_bits
+  void add(const vector<uint64_t> &words, int nr_bits) {
+    for (int w = 0; w * 64 < nr_bits; w++) {
+      int len = min(64, nr_bits - w * 64);
+      uint64_t prefix = words[w];  // bit i becomes the parity of x_0...x_i
+      for (int shift = 1; shift < 64; shift *= 2) prefix ^= prefix << shift;
+      if (!is_even) prefix = ~prefix;
+      if (len < 64) prefix &= (uint64_t(1) << len) - 1;
 
-    if (is_even)
-      even++;
-    else
-      odd++;
+      int nr_odd = __builtin_popcountll(prefix);
+      odd += nr_odd;
+      even += len - nr_odd;
+      is_even = !(prefix >> (len - 1) & 1);
+    }
   }
 
-  cout << even * (even - 1) / 2  // nr of pairs of S_(i-1) and S_j when both even
-    + odd * (odd - 1) / 2  // nr of pairs of S_(i-1) and S_j when both odd
-    + even   // nr of x_0...x_i even sums
-    << endl;
+  long count() const {
+    return even * (even - 1) / 2  // nr of pairs of S_(i-1) and S_j when both even
+           + odd * (odd - 1) / 2  // nr of pairs of S_(i-1) and S_j when both odd
+           + even;                // nr of x_0...x_i even sums
+  }
+};
+
+void solve() {
+  const int CHUNK_BITS = 1 << 16;
+  int n;
+  cin >> n;
+
+  even_pairs pairs;
+  vector<uint64_t> chunk(CHUNK_BITS / 64);
+  for (int read = 0; read < n;) {
+    int nr_bits = min(CHUNK_BITS, n - read);
+    fill(chunk.begin(), chunk.end(), 0);
+    for (int i = 0; i < nr_bits; i++) {
+      int t;
+      cin >> t;
+      chunk[i / 64] |= (uint64_t)(t == 1) << (i % 64);
+    }
+    pairs.add(chunk, nr_bits);
+    read += nr_bits;
+  }
+
+  cout << pairs.count() << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
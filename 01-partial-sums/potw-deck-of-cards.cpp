@@ -34,11 +34,12 @@ void solve() {
     right++;
     sum += cards[right];
   }
-  cout << best_left << " " << best_right << endl;
+  cout << best_left << " " << best_right << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -1,6 +1,12 @@
 /*
-Sliding window over possible coordinates
+Sliding window over the sorted parasols
 to find the most parasols within 100m range.
+
+Every candidate bar covers a window of consecutive parasols spanning at most
+200m, and the best spot for a window is its midpoint (or the two integers next
+to it). So instead of scanning every coordinate, we move the window over the
+parasols: for every left parasol take the furthest right parasol in range.
+This is O(n log n) regardless of how far apart the parasols are.
 */
 
 #include <algorithm>
@@ -12,69 +18,52 @@ using namespace std;
 void solve() {
   int nr_parasol;
   cin >> nr_parasol;
-  vector<int> coordinates(nr_parasol);
+  vector<long> coordinates(nr_parasol);
   for (int i = 0; i < nr_parasol; i++) cin >> coordinates[i];
 
   sort(coordinates.begin(), coordinates.end());
 
-  int max_nr = 0, best_dist, curr_dist;
-  int index_left = 0, index_curr = 0,
-      index_right = -1;  // index for new el in p
-  int coord = coordinates[0] - 100, ld = 0, rd = 0, curr_nr = 0;
-  vector<int> optimal_positions;
+  int max_nr = 0;
+  long best_dist = 0;
+  vector<long> optimal_positions;
 
-  while (coordinates[nr_parasol - 1] >= coord) {
-    // last left out of bounds
-    if (coord - coordinates[index_left] > 100) {
-      curr_nr--;
-      index_left++;
-    }
-    // new right in bounds
-    if (index_right != nr_parasol - 1 &&
-        coordinates[index_right + 1] - coord == 100) {
-      curr_nr++;
+  for (int index_left = 0, index_right = 0; index_left < nr_parasol;
+       index_left++) {
+    while (index_right + 1 < nr_parasol &&
+           coordinates[index_right + 1] - coordinates[index_left] <= 200)
       index_right++;
-    }
 
-    // handle p in curr midpoint
-    if (coord == coordinates[index_curr]) {
-      index_curr++;
-    }
+    int curr_nr = index_right - index_left + 1;
+    long span = coordinates[index_right] - coordinates[index_left];
+    long curr_dist = (span + 1) / 2;
 
-    // check if new best
-    curr_dist =
-        max(coord - coordinates[index_left], coordinates[index_right] - coord);
-    // cout << "calc max d: curr " << x << " l, r " << p[li] << " " << p[ri]
-    // << endl;
-    if (max_nr < curr_nr) {
+    if (curr_nr > max_nr || (curr_nr == max_nr && curr_dist < best_dist)) {
       max_nr = curr_nr;
       best_dist = curr_dist;
       optimal_positions.clear();
-      optimal_positions.push_back(coord);
-    } else if (max_nr == curr_nr) {
-      if (curr_dist < best_dist) {
-        best_dist = curr_dist;
-        optimal_positions.clear();
-      }
-      if (best_dist == curr_dist) {
-        optimal_positions.push_back(coord);
-      }
+    } else if (curr_nr < max_nr || curr_dist > best_dist) {
+      continue;
     }
 
-    coord += 1;
+    // midpoint, rounded down, and the next integer if the span is odd
+    long sum = coordinates[index_left] + coordinates[index_right];
+    long mid = sum >= 0 ? sum / 2 : -((1 - sum) / 2);
+    optimal_positions.push_back(mid);
+    if (span % 2 == 1) optimal_positions.push_back(mid + 1);
   }
 
-  cout << max_nr << " " << best_dist << endl;
-  for (int opt : optimal_positions) {
+  cout << max_nr << " " << best_dist << "\n";
+  for (long opt : optimal_positions) {
     cout << opt << " ";
   }
-  cout << endl;
+  cout << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
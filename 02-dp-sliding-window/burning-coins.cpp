@@ -1,33 +1,38 @@
 /*
 DP to find the maximum possible sum of chosen coins in a 2 player game.
+
+F(i, j) represents the maximum value the user
+can collect from i'th coin to j'th coin.
+
+F(i, j) = Vi + F(i+1, j) or Vj + F(i, j-1)  if it is the user's turn
+F(i, j) = min(F(i+1, j), F(i, j-1))          if it is the opponent's turn
+As user wants to maximise the number of coins and the opponent minimises them.
+
+Whose turn it is only depends on the length of the interval, so the table is
+filled bottom-up by interval length. Intervals of one length only need the
+intervals one coin shorter, so a single row of size n is updated in place.
 */
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
 using namespace std;
 
-int rec(vector<int> &coins, int left, int right, vector<vector<int>> &memo) {
-  /*
-  F(i, j) represents the maximum value the user
-  can collect from i'th coin to j'th coin.
-
-  F(i, j) = Max(Vi + min(F(i+2, j), F(i+1, j-1) ),
-                Vj + min(F(i+1, j-1), F(i, j-2) ))
-  As user wants to maximise the number of coins.
-
-  Base Cases
-      F(i, j) = Vi           If j == i
-      F(i, j) = max(Vi, Vj)  If j == i + 1
-  */
-  if (left == right) return coins[left];
-  if (left + 1 == right) return max(coins[left], coins[right]);
-
-  if (memo[left][right] == -1)
-    memo[left][right] =
-        max(coins[left] + min(rec(coins, left + 2, right, memo), rec(coins, left + 1, right - 1, memo)),
-            coins[right] + min(rec(coins, left + 1, right - 1, memo), rec(coins, left, right - 2, memo)));
-  return memo[left][right];
+// value collected by player `me` out of nr_players taking turns, starting with 0
+int interval_dp(const vector<int> &coins, int nr_players, int me) {
+  const int n = coins.size();
+  // dp[l] is the value of the interval of current length starting at l
+  vector<int> dp(n + 1, 0);
+  for (int len = 1; len <= n; len++) {
+    const int player = (n - len) % nr_players;
+    if (player == me)
+      for (int l = 0; l + len <= n; l++)
+        dp[l] = max(coins[l] + dp[l + 1], coins[l + len - 1] + dp[l]);
+    else
+      for (int l = 0; l + len <= n; l++) dp[l] = min(dp[l + 1], dp[l]);
+  }
+  return dp[0];
 }
 
 void solve() {
@@ -36,14 +41,14 @@ void solve() {
   vector<int> coins(nr_coins);
   for (int i = 0; i < nr_coins; i++) cin >> coins[i];
 
-  vector<vector<int>> memo(nr_coins, vector<int>(nr_coins, -1));
-  cout << rec(coins, 0, nr_coins - 1, memo) << endl;
+  cout << interval_dp(coins, 2, 0) << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
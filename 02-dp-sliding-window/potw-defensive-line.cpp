@@ -4,10 +4,10 @@ attack strength and number of attackers.
 
 1. Sliding window to find all segments we can attack such that
 sum of defenses = attack strength.
-2. Recursion with memoization or DP on segments to maximize result.
-
-Debug stuff: need to mark empty spot in memo with -2, since our rec can return
--1.
+2. DP on segments to maximize result, going backwards over the positions.
+best[pos] is the max nr of attacked players from pos on, or -1 if the attackers
+can't all get a segment. It only depends on the row for one attacker less, so
+we keep two rows of size n instead of an n x k table.
 */
 
 #include <algorithm>
@@ -16,24 +16,6 @@ Debug stuff: need to mark empty spot in memo with -2, since our rec can return
 
 using namespace std;
 
-int rec(vector<int> &segments, int pos, int nr_att, vector<vector<int>> &memo) {
-  if (nr_att == 0) return 0;
-  if (pos >= -1 + (int)segments.size()) return -1;
-
-  if (memo[pos][nr_att] == -2) {
-    int not_chosen = rec(segments, pos + 1, nr_att, memo);
-    memo[pos][nr_att] = not_chosen;
-
-    int next_pos = segments[pos];
-    if (next_pos != -1) {
-      int chosen_rec = rec(segments, next_pos + 1, nr_att - 1, memo);
-      int chosen = 1 + next_pos - pos + chosen_rec;
-      if (chosen_rec != -1) memo[pos][nr_att] = max(chosen, not_chosen);
-    }
-  }
-  return memo[pos][nr_att];
-}
-
 void solve() {
   int nr_players, nr_attackers, attack_strength;
   cin >> nr_players >> nr_attackers >> attack_strength;
@@ -54,17 +36,29 @@ void solve() {
     }
   }
 
-  // recursion with memoization
-  vector<vector<int>> memo(nr_players + 1, vector<int>(nr_attackers + 1, -2));
-  int val = rec(segments, 0, nr_attackers, memo);
+  // with zero attackers we attack no players from any position
+  vector<int> prev(nr_players + 1, 0), best(nr_players + 1);
+  for (int att = 1; att <= nr_attackers; att++) {
+    best[nr_players] = -1;
+    for (int pos = nr_players - 1; pos >= 0; pos--) {
+      best[pos] = best[pos + 1];  // not chosen
+
+      int next_pos = segments[pos];
+      if (next_pos != -1 && prev[next_pos + 1] != -1)
+        best[pos] = max(best[pos], 1 + next_pos - pos + prev[next_pos + 1]);
+    }
+    swap(prev, best);
+  }
+  int val = prev[0];
   if (val == -1)
-    cout << "fail" << endl;
+    cout << "fail\n";
   else
-    cout << val << endl;
+    cout << val << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -1,47 +1,49 @@
+/*
+DP to find the maximum sum a passenger can collect when the passengers take
+coins from either end in turns and everyone else plays against them.
+
+Whose turn it is only depends on the number of coins already taken, i.e. on
+the length of the interval, so the table is filled bottom-up by interval
+length. Intervals of one length only need the intervals one coin shorter, so a
+single row of size n is updated in place.
+*/
+
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
 using namespace std;
 
-int rec(vector<int> &values, int l, int r, int nr_players, int curr_player,
-        int maxi_player, vector<vector<int>> &mini) {
-  if (l == r) return maxi_player == curr_player ? values[l] : 0;
-  if (l + 1 == r) {
-    if (maxi_player == curr_player)
-      return max(values[l], values[r]);
-    else if (maxi_player == curr_player + 1)
-      return min(values[l], values[r]);
+// value collected by player `me` out of nr_players taking turns, starting with 0
+int interval_dp(const vector<int> &coins, int nr_players, int me) {
+  const int n = coins.size();
+  // dp[l] is the value of the interval of current length starting at l
+  vector<int> dp(n + 1, 0);
+  for (int len = 1; len <= n; len++) {
+    const int player = (n - len) % nr_players;
+    if (player == me)
+      for (int l = 0; l + len <= n; l++)
+        dp[l] = max(coins[l] + dp[l + 1], coins[l + len - 1] + dp[l]);
     else
-      return 0;
-  };
-
-  int next_player = curr_player == nr_players ? 0 : curr_player + 1;
-  if (curr_player == maxi_player)
-    return max(values[l] + rec(values, l + 1, r, nr_players, next_player, maxi_player, mini),
-               values[r] + rec(values, l, r - 1, nr_players, next_player, maxi_player, mini));
-  if (mini[l][r] == -1)
-    mini[l][r] = min(rec(values, l + 1, r, nr_players, next_player, maxi_player, mini),
-                    rec(values, l, r - 1, nr_players, next_player, maxi_player, mini));
-  return mini[l][r];
+      for (int l = 0; l + len <= n; l++) dp[l] = min(dp[l + 1], dp[l]);
+  }
+  return dp[0];
 }
 
 void solve() {
   int nr_coins, nr_passengers, index_passenger;
   cin >> nr_coins >> nr_passengers >> index_passenger;
   vector<int> coin_values(nr_coins);
-  vector<vector<int>> mini(
-      vector<vector<int>>(nr_coins, vector<int>(nr_coins, -1)));
   for (int i = 0; i < nr_coins; i++) cin >> coin_values[i];
 
-  cout << rec(coin_values, 0, nr_coins - 1, nr_passengers - 1, 0,
-              index_passenger, mini)
-       << endl;
+  cout << interval_dp(coin_values, nr_passengers, index_passenger) << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
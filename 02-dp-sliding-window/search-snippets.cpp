@@ -1,9 +1,18 @@
 /*
 Sliding window over words in a text to find the shortest possible
 snippet length containing all required words.
+
+The occurrences of every word are already sorted, so instead of sorting all
+positions together we merge the lists: a min-heap holds the current occurrence
+of every word, the snippet reaches from the heap top to the largest current
+occurrence, and we advance the word at the top until one list runs out.
+This saves the sort, not the memory: the input gives all counts first and then
+the lists word after word, so every position is still read into one array.
 */
 
 #include <algorithm>
+#include <climits>
+#include <functional>
 #include <iostream>
 #include <queue>
 #include <vector>
@@ -13,45 +22,46 @@ using namespace std;
 void solve() {
   int n;
   cin >> n;
-  vector<int> word_occurence(n);
-  for (int i = 0; i < n; i++) cin >> word_occurence[i];
-  vector<pair<int, int>> positions;
-  int min_valid = 0;
+  // occurrences of word i are positions[start[i]] .. positions[start[i+1]-1]
+  vector<int> start(n + 1, 0);
+  for (int i = 0; i < n; i++) {
+    int word_occurence;
+    cin >> word_occurence;
+    start[i + 1] = start[i] + word_occurence;
+  }
+  vector<int> positions(start[n]);
+  for (int &pos : positions) cin >> pos;
+
+  // current occurrence of every word, smallest position first
+  typedef pair<int, int> occurrence;  // position, word
+  priority_queue<occurrence, vector<occurrence>, greater<occurrence>> heap;
+  vector<int> next(n);
+  int to = 0;
   for (int i = 0; i < n; i++) {
-    for (int j = 0; j < word_occurence[i]; j++) {
-      int pos;
-      cin >> pos;
-      if (j == 0) min_valid = max(min_valid, pos);
-      positions.push_back({pos, i});
-    }
+    heap.push({positions[start[i]], i});
+    next[i] = start[i] + 1;
+    to = max(to, positions[start[i]]);
   }
 
-  sort(positions.begin(), positions.end(),
-       [&](const auto p1, const auto p2) { return p1 < p2; });
-
-  vector<int> last_seen(n, -1);
-  queue<pair<int, int>> Q;
-  int from = positions[0].first, to = 0;
-  int shortest_length = 1410065408;
-  for (auto p : positions) {
-    to = p.first;
-    Q.push(p);
-    last_seen[p.second] = p.first;
-    if (p.first < min_valid) continue;
-
-    while (last_seen[Q.front().second] > Q.front().first) {
-      Q.pop();
-      from = Q.front().first;
-    }
+  int shortest_length = INT_MAX;
+  while (true) {
+    int from = heap.top().first, word = heap.top().second;
+    heap.pop();
     shortest_length = min(shortest_length, to - from + 1);
+
+    if (next[word] == start[word + 1]) break;
+    int pos = positions[next[word]++];
+    to = max(to, pos);
+    heap.push({pos, word});
   }
-  cout << shortest_length << endl;
+  cout << shortest_length << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
@@ -1,5 +1,10 @@
 /*
 DP to build the results of a two player game with minmax algorithm.
+
+The incoming edges of every position are stored contiguously (CSR), built from
+the edge list with one counting pass and one filling pass. The min and max
+values of all positions are computed once, so any number of meeple starting
+positions can be looked up afterwards.
 */
 
 #include <algorithm>
@@ -8,45 +13,65 @@ DP to build the results of a two player game with minmax algorithm.
 
 using namespace std;
 
+struct game_values {
+  vector<int> mini, maxi;
+};
+
+// positions are reversed so that the last winning position is 0,
+// and every edge goes from a larger to a smaller position
+game_values compute_game_values(int vertices,
+                                const vector<pair<int, int>> &edges) {
+  // incoming edges of pos are sources[offset[pos]] .. sources[offset[pos+1]-1]
+  vector<int> offset(vertices + 1, 0), sources(edges.size());
+  for (auto &e : edges) offset[e.second + 1]++;
+  for (int pos = 0; pos < vertices; pos++) offset[pos + 1] += offset[pos];
+  vector<int> fill(offset.begin(), offset.end() - 1);
+  for (auto &e : edges) sources[fill[e.second]++] = e.first;
+
+  // min and max values for each position
+  game_values g = {vector<int>(vertices, vertices), vector<int>(vertices, -1)};
+  g.mini[0] = 0;
+  g.maxi[0] = 0;
+  for (int pos = 0; pos < vertices; pos++) {
+    for (int i = offset[pos]; i < offset[pos + 1]; i++) {
+      int option = sources[i];
+      g.mini[option] = min(g.mini[option], g.maxi[pos] + 1);
+      g.maxi[option] = max(g.maxi[option], g.mini[pos] + 1);
+    }
+  }
+  return g;
+}
+
 void solve() {
-  int vertices, edges;
-  cin >> vertices >> edges;
+  int vertices, nr_edges;
+  cin >> vertices >> nr_edges;
   int meeple_sherlock, meeple_moriarty;
   cin >> meeple_sherlock >> meeple_moriarty;
   // so the last winning position = 0
   auto reverse_pos = [&](int pos) { return vertices - pos; };
 
-  vector<vector<int>> incoming_edges(vertices);
-  for (int i = 0; i < edges; i++) {
+  vector<pair<int, int>> edges(nr_edges);
+  for (auto &e : edges) {
     int s, t;
     cin >> s >> t;
-    incoming_edges[reverse_pos(t)].push_back(reverse_pos(s));
+    e = {reverse_pos(s), reverse_pos(t)};
   }
+  game_values g = compute_game_values(vertices, edges);
 
-  // min and max values for each position
-  vector<int> mini(vertices, vertices), maxi(vertices, -1);
-  mini[0] = 0;
-  maxi[0] = 0;
-  for (int pos = 0; pos < vertices; pos++) {
-    for (int option : incoming_edges[pos]) {
-      mini[option] = min(mini[option], maxi[pos] + 1);
-      maxi[option] = max(maxi[option], mini[pos] + 1);
-    }
-  }
-
-  int moves_sherlock = mini[reverse_pos(meeple_sherlock)];
-  int moves_moriarty = mini[reverse_pos(meeple_moriarty)];
+  int moves_sherlock = g.mini[reverse_pos(meeple_sherlock)];
+  int moves_moriarty = g.mini[reverse_pos(meeple_moriarty)];
   if (moves_sherlock < moves_moriarty ||
       (moves_sherlock == moves_moriarty && moves_sherlock % 2 == 1)) {
-    cout << 0 << endl;  // sherlock win
+    cout << 0 << "\n";  // sherlock win
   } else
-    cout << 1 << endl;  // moriarty win
+    cout << 1 << "\n";  // moriarty win
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
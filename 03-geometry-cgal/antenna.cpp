@@ -2,14 +2,25 @@
 Finding the min circle containing all points using CGAL min_circle_2.
 Tip: Don't use kernel with sqrt. When rounding up,
 compare FT(sqrt_val)*FT(sqrt_val) with the FT value of squared radius.
+
+Exact constructions are slow, so the circle is first computed with the
+inexact kernel. Its support points are then checked with exact predicates: the
+circle through them has to contain every point, and for three support points the
+triangle must not be obtuse (otherwise a smaller circle exists). Only the final
+radius is constructed exactly from the support points; if the check fails we
+compute the circle with the exact kernel from scratch.
 */
 
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Min_circle_2.h>
 #include <CGAL/Min_circle_2_traits_2.h>
 
+typedef CGAL::Exact_predicates_inexact_constructions_kernel IK;
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CGAL::Min_circle_2_traits_2<IK> ITraits;
 typedef CGAL::Min_circle_2_traits_2<K> Traits;
+typedef CGAL::Min_circle_2<ITraits> IMin_circle;
 typedef CGAL::Min_circle_2<Traits> Min_circle;
 
 long double_to_sqrt_ceil(const K::FT &val) {
@@ -19,21 +30,64 @@ long double_to_sqrt_ceil(const K::FT &val) {
    return a;
 }
 
+K::Point_2 to_exact(const IK::Point_2 &p) { return K::Point_2(p.x(), p.y()); }
+
+// exact squared radius of the min circle, exact kernel only when needed
+K::FT min_circle_squared_radius(const std::vector<IK::Point_2> &points) {
+  IMin_circle inexact(points.begin(), points.end(), true);
+  std::vector<IK::Point_2> support(inexact.support_points_begin(),
+                                   inexact.support_points_end());
+
+  // the support points are input points, so the filtered predicates of the
+  // inexact kernel decide everything exactly without constructing a circle
+  bool certified = true;
+  if (support.size() == 2) {
+    for (auto &t : points)
+      if (CGAL::side_of_bounded_circle(support[0], support[1], t) ==
+          CGAL::ON_UNBOUNDED_SIDE)
+        certified = false;
+  } else if (support.size() == 3) {
+    if (CGAL::collinear(support[0], support[1], support[2])) certified = false;
+    for (int i = 0; certified && i < 3; i++)
+      if (CGAL::angle(support[(i + 1) % 3], support[i], support[(i + 2) % 3]) ==
+          CGAL::OBTUSE)
+        certified = false;
+    for (int i = 0; certified && i < (int)points.size(); i++)
+      if (CGAL::side_of_bounded_circle(support[0], support[1], support[2],
+                                       points[i]) == CGAL::ON_UNBOUNDED_SIDE)
+        certified = false;
+  }
+  if (certified) {
+    if (support.size() == 1) return K::FT(0);
+    if (support.size() == 2)
+      return K::Circle_2(to_exact(support[0]), to_exact(support[1]))
+          .squared_radius();
+    return K::Circle_2(to_exact(support[0]), to_exact(support[1]),
+                       to_exact(support[2]))
+        .squared_radius();
+  }
+
+  std::vector<K::Point_2> exact_points;
+  exact_points.reserve(points.size());
+  for (auto &p : points) exact_points.push_back(to_exact(p));
+  Min_circle exact(exact_points.begin(), exact_points.end(), true);
+  return exact.circle().squared_radius();
+}
+
 int main() {
   std::ios_base::sync_with_stdio(false);
+  std::cin.tie(nullptr);
   int nr_points; std::cin >> nr_points;
   
   while (nr_points) {
-    std::vector<K::Point_2> points(nr_points);
+    std::vector<IK::Point_2> points(nr_points);
     for (int i = 0; i < nr_points; i++) {
       long x, y; std::cin >> x >> y;
-      points[i] = K::Point_2(x, y);
+      points[i] = IK::Point_2(x, y);
     }
     
-    Min_circle min_circle(points.begin(), points.end(), true);
-    Traits::Circle circle = min_circle.circle();
-    std::cout << double_to_sqrt_ceil(circle.squared_radius()) << std::endl;
+    std::cout << double_to_sqrt_ceil(min_circle_squared_radius(points)) << "\n";
  
     std::cin >> nr_points;
   }
-}
\ No newline at end of file
+}
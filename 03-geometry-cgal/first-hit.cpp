@@ -4,13 +4,24 @@ Epec kernel because we need to calculate exact values of intersections.
 
 Tip: When one intersection found, use a new Segment(ray_start, intersection)
 to find new intersections.
+
+Each closer hit costs an exact construction. If the segments come sorted from
+far to near, every segment is a closer hit, so we shuffle them first: then the
+expected number of constructions is logarithmic. Segments that miss the whole
+ray are rejected with the cheaper Epic predicates before touching Epec.
 */
 
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
 
 using namespace std;
 
 typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CGAL::Exact_predicates_inexact_constructions_kernel IK;
 
 double floor_to_double(const K::FT& x) {
   double a = floor(CGAL::to_double(x));
@@ -19,8 +30,12 @@ double floor_to_double(const K::FT& x) {
   return a;
 }
 
+K::Point_2 to_exact(const IK::Point_2& p) { return K::Point_2(p.x(), p.y()); }
+
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
+  mt19937 rng(42);
 
   while (true) {
     int n;
@@ -29,47 +44,49 @@ int main() {
     long x, y, a, b;
     cin >> x >> y >> a >> b;
 
-    K::Point_2 p1, p2;
-    vector<vector<long>> segments(n);
-
+    // input coordinates are integers, so Epic represents them exactly
+    vector<IK::Segment_2> segments;
+    segments.reserve(n);
     for (int i = 0; i < n; i++) {
       long r, s, t, u;
       cin >> r >> s >> t >> u;
-      segments[n] = {r, s, t, u};
+      segments.emplace_back(IK::Point_2(r, s), IK::Point_2(t, u));
     }
+    shuffle(segments.begin(), segments.end(), rng);
 
+    IK::Ray_2 inexact_ray = IK::Ray_2(IK::Point_2(x, y), IK::Point_2(a, b));
     K::Point_2 start = K::Point_2(x, y);
     auto ray = K::Ray_2(start, K::Point_2(a, b));
     K::Segment_2 ray_seg;
     bool is_intersect = false;
     K::Point_2 min_point;
 
-    for (vector<long> seg_points : segments) {
-      K::Segment_2 seg = K::Segment_2(K::Point_2(seg_points[0], seg_points[1]),
-                                      K::Point_2(seg_points[2], seg_points[3]));
-      bool intersect = is_intersect ? CGAL::do_intersect(seg, ray_seg)
-                                    : CGAL::do_intersect(seg, ray);
-      if (intersect) {
-        is_intersect = true;
-        auto o = CGAL::intersection(seg, ray);
-        if (const K::Point_2* op = boost::get<K::Point_2>(&*o))
-          min_point = *op;
-        else if (const K::Segment_2* os = boost::get<K::Segment_2>(&*o)) {
-          if (K::Segment_2(start, os->source()).squared_length() <
-              K::Segment_2(start, os->target()).squared_length())
-            min_point = os->source();
-          else
-            min_point = os->target();
-        }
-        ray_seg = K::Segment_2(start, min_point);
+    for (const IK::Segment_2& inexact_seg : segments) {
+      if (!CGAL::do_intersect(inexact_seg, inexact_ray)) continue;
+
+      K::Segment_2 seg = K::Segment_2(to_exact(inexact_seg.source()),
+                                      to_exact(inexact_seg.target()));
+      if (is_intersect && !CGAL::do_intersect(seg, ray_seg)) continue;
+
+      is_intersect = true;
+      auto o = CGAL::intersection(seg, ray);
+      if (const K::Point_2* op = boost::get<K::Point_2>(&*o))
+        min_point = *op;
+      else if (const K::Segment_2* os = boost::get<K::Segment_2>(&*o)) {
+        if (K::Segment_2(start, os->source()).squared_length() <
+            K::Segment_2(start, os->target()).squared_length())
+          min_point = os->source();
+        else
+          min_point = os->target();
       }
+      ray_seg = K::Segment_2(start, min_point);
     }
 
     if (is_intersect)
       cout << (long)floor_to_double(min_point.x()) << " "
-           << (long)floor_to_double(min_point.y()) << endl;
+           << (long)floor_to_double(min_point.y()) << "\n";
     else
-      cout << "no" << endl;
+      cout << "no\n";
   }
 
   return 0;
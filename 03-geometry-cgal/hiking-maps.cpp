@@ -5,10 +5,15 @@ Sliding window over triangles.
 
 Tip: Try to use epic for speed -> cannot construct triangles.
 Use right() to find orientation of one point to another 2.
+
+For every triangle we store the legs it covers. Moving the window then only
+touches the counters of those legs, and we keep track of how many legs are
+still uncovered instead of checking all counters.
 */
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 
+#include <array>
 #include <cassert>
 #include <iostream>
 #include <vector>
@@ -28,8 +33,8 @@ vector<K::Point_2> read_points(int points_nr) {
 }
 
 struct Triangle {
-  vector<K::Point_2> points;  // size 6
-  vector<bool> is_rights;     // size 3
+  array<K::Point_2, 6> points;
+  array<bool, 3> is_rights;
 };
 
 vector<Triangle> read_triangles(int triangles_nr) {
@@ -37,21 +42,26 @@ vector<Triangle> read_triangles(int triangles_nr) {
   // be in the triangle
   vector<Triangle> triangles(triangles_nr);
   for (int i_tri = 0; i_tri < triangles_nr; i_tri++) {
-    vector<K::Point_2> points = read_points(6);
-    vector<bool> is_rights(3);
+    Triangle &triangle = triangles[i_tri];
+    for (auto &point : triangle.points) {
+      int x, y;
+      cin >> x >> y;
+      point = K::Point_2(x, y);
+    }
     for (int i_edge = 0; i_edge < 3; i_edge++) {
-      K::Point_2 p = points[i_edge * 2], q = points[i_edge * 2 + 1],
-                 r = points[(i_edge * 2 + 2) % 6];
-      is_rights[i_edge] = CGAL::right_turn(p, q, r);
+      const K::Point_2 &p = triangle.points[i_edge * 2],
+                       &q = triangle.points[i_edge * 2 + 1],
+                       &r = triangle.points[(i_edge * 2 + 2) % 6];
+      triangle.is_rights[i_edge] = CGAL::right_turn(p, q, r);
     }
-    triangles[i_tri] = {points, is_rights};
   }
   return triangles;
 }
 
-bool in_triangle(Triangle &triangle, K::Point_2 &point) {
+bool in_triangle(const Triangle &triangle, const K::Point_2 &point) {
   for (int i_edge = 0; i_edge < 3; i_edge++) {
-    K::Point_2 p1 = triangle.points[i_edge * 2], p2 = triangle.points[i_edge * 2 + 1];
+    const K::Point_2 &p1 = triangle.points[i_edge * 2],
+                     &p2 = triangle.points[i_edge * 2 + 1];
     bool in = CGAL::right_turn(p1, p2, point) == triangle.is_rights[i_edge] ||
               CGAL::collinear(p1, p2, point);
     if (!in) return false;  // has to be one of them
@@ -59,44 +69,45 @@ bool in_triangle(Triangle &triangle, K::Point_2 &point) {
   return true;
 }
 
-bool all_positive(vector<int> counts) {
-  for (auto count : counts)
-    if (count == 0) return false;
-  return true;
-}
-
 void solve() {
   int nr_points, nr_tri;
   cin >> nr_points >> nr_tri;
   vector<K::Point_2> points = read_points(nr_points);
   vector<Triangle> triangles = read_triangles(nr_tri);
 
-  vector<vector<bool>> contains_point(nr_tri, vector<bool>(nr_points));
+  // legs of triangle i are legs[start[i]] .. legs[start[i+1]-1]
+  vector<int> start(nr_tri + 1, 0), legs;
+  vector<bool> contains_point(nr_points);
   for (int i_tri = 0; i_tri < nr_tri; i_tri++) {
-    Triangle t = triangles[i_tri];
     for (int i_point = 0; i_point < nr_points; i_point++)
-      contains_point[i_tri][i_point] = in_triangle(t, points[i_point]);
+      contains_point[i_point] = in_triangle(triangles[i_tri], points[i_point]);
+    for (int i_leg = 0; i_leg < nr_points - 1; i_leg++)
+      if (contains_point[i_leg] && contains_point[i_leg + 1])
+        legs.push_back(i_leg);
+    start[i_tri + 1] = legs.size();
   }
 
-  vector<int> segment_count(nr_points - 1);
+  vector<int> leg_count(nr_points - 1, 0);
+  int uncovered = nr_points - 1;
   int triangle_count = 0, best_count = nr_tri, i_left_tri = 0;
   for (int i_right_tri = 0; i_right_tri < nr_tri; i_right_tri++) {
-    for (int i_point = 0; i_point < nr_points - 1; i_point++)
-      segment_count[i_point] += contains_point[i_right_tri][i_point] && contains_point[i_right_tri][i_point + 1];
+    for (int i = start[i_right_tri]; i < start[i_right_tri + 1]; i++)
+      if (leg_count[legs[i]]++ == 0) uncovered--;
     triangle_count++;
-    while (all_positive(segment_count)) {
+    while (uncovered == 0) {
       best_count = min(triangle_count, best_count);
-      for (int i_point = 0; i_point < nr_points - 1; i_point++)
-        segment_count[i_point] -= contains_point[i_left_tri][i_point] && contains_point[i_left_tri][i_point + 1];
+      for (int i = start[i_left_tri]; i < start[i_left_tri + 1]; i++)
+        if (--leg_count[legs[i]] == 0) uncovered++;
       i_left_tri++;
       triangle_count--;
     }
   }
-  cout << best_count << endl;
+  cout << best_count << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -11,6 +11,7 @@ typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
 
   while (true) {
     int n;
@@ -21,7 +22,6 @@ int main() {
     cin >> x >> y >> a >> b;
     K::Ray_2 path = K::Ray_2(K::Point_2(x, y), K::Point_2(a, b));
 
-    K::Point_2 p1, p2;
     bool intersect = false;
     while (n--) {
       long r, s, t, u;
@@ -31,9 +31,7 @@ int main() {
       intersect = CGAL::do_intersect(seg, path);
     }
 
-    K::Ray_2 g = K::Ray_2(K::Point_2(x, y), K::Point_2(a, b));
-
-    cout << (intersect ? "yes" : "no") << endl;
+    cout << (intersect ? "yes" : "no") << "\n";
   }
 
   return 0;
@@ -11,25 +11,34 @@ compared to the previous rays.
 These rays can "kill" previous rays as long as they are
 1. smaller in absolute value -> shorter segment to intersection
 2. larger otherwise -> the intersection happens
+
+Slopes are the fractions dy / dx with dx > 0, so we compare them exactly by
+cross-multiplying in 128 bits instead of using an exact number type.
 */
-#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 
 #include <algorithm>
 #include <iostream>
 #include <vector>
 
-typedef CGAL::Exact_predicates_exact_constructions_kernel K;
-
 using namespace std;
 
 struct biker {
   int i;
   long y0;
-  K::FT slope;
+  long dy, dx;  // slope = dy / dx, dx > 0
 };
 
 bool compare_y0(const biker &b1, const biker &b2) { return b1.y0 > b2.y0; }
-bool compare_index(const biker &b1, const biker &b2) { return b1.i < b2.i; }
+
+// -1, 0 or 1 as a/b is smaller, equal or larger than c/d, for b, d > 0
+int compare_fractions(__int128 a, __int128 b, __int128 c, __int128 d) {
+  __int128 left = a * d, right = c * b;
+  return (left > right) - (left < right);
+}
+
+bool slope_less_equal(const biker &b1, const biker &b2) {
+  return compare_fractions(b1.dy, b1.dx, b2.dy, b2.dx) <= 0;
+}
 
 void solve() {
   int n;
@@ -38,48 +47,50 @@ void solve() {
   for (int i = 0; i < n; i++) {
     long y0, x1, y1;
     cin >> y0 >> x1 >> y1;
-    bikers[i] = {i, y0, K::FT(y1 - y0) / K::FT(x1)};
+    bikers[i] = {i, y0, y1 - y0, x1};
   }
   // for greedy selection, sort by starting position
   sort(bikers.begin(), bikers.end(), compare_y0);
 
-  vector<biker> winners;
-  winners.push_back(bikers[0]);
+  // stack of the current winners, preallocated since it never exceeds n
+  vector<int> winners(n);
+  winners[0] = 0;
   int last = 0;
 
   auto kills = [](const biker &killer, const biker &ray) {
-    return abs(killer.slope) <= abs(ray.slope) && killer.slope > ray.slope;
+    bool not_steeper =
+        compare_fractions(abs(killer.dy), killer.dx, abs(ray.dy), ray.dx) <= 0;
+    return not_steeper && !slope_less_equal(killer, ray);
   };
   for (int i = 1; i < n; i++) {
-    biker biker = bikers[i];
+    const biker &biker = bikers[i];
     // we have a smaller slope than last
     // so the current bike and above bikes never cross
-    if (biker.slope <= winners[last].slope) {
-      winners.push_back(biker);
-      last++;
+    if (slope_less_equal(biker, bikers[winners[last]])) {
+      winners[++last] = i;
     }
     // a lower ray "kills" higher rays
-    else if (kills(biker, winners[last])) {
-      while (last >= 0 && kills(biker, winners[last])) last--;
-      winners.erase(winners.begin() + last + 1, winners.end());
+    else if (kills(biker, bikers[winners[last]])) {
+      while (last >= 0 && kills(biker, bikers[winners[last]])) last--;
 
-      if (last == -1 || biker.slope <= winners[last].slope) {
-        winners.push_back(biker);
-        last++;
-      }
+      if (last == -1 || slope_less_equal(biker, bikers[winners[last]]))
+        winners[++last] = i;
     }
   }
 
-  sort(winners.begin(), winners.end(), compare_index);
-
-  for (auto winner : winners) cout << winner.i << " ";
-  cout << endl;
+  // print the winners by their original index
+  vector<bool> is_winner(n, false);
+  for (int w = 0; w <= last; w++) is_winner[bikers[winners[w]].i] = true;
+  for (int i = 0; i < n; i++)
+    if (is_winner[i]) cout << i << " ";
+  cout << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
@@ -1,15 +1,21 @@
 /*
 Find the minimum weight path from start to end, using multiple subgraphs.
 1. Construct MST for each subgraph (due to the problem - how forest is explored).
-2. Hold a main graph, where we either add edge from subgraph MST or change
-weight to minimum of existing and new weight.
+Kruskal runs directly on the edge list: sort the edge indices by the species'
+weights and join components with union-find, no graph needed per species.
+2. For every edge keep the minimum weight over all species whose MST contains
+it, and add each such edge once to the main graph.
 3. Run Dijkstra to find shortest start-end path.
 */
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
-#include <boost/graph/kruskal_min_spanning_tree.hpp>
+#include <boost/pending/disjoint_sets.hpp>
+#include <algorithm>
+#include <climits>
 #include <iostream>
+#include <numeric>
+#include <vector>
 
 typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS,
                               boost::no_property,
@@ -25,20 +31,13 @@ void solve() {
   int nr_trees, nr_edges, nr_species, start, end;
   cin >> nr_trees >> nr_edges >> nr_species >> start >> end;
 
-  weighted_graph G(nr_trees);
-  vector<edge_desc> edges(nr_edges);
-  vector<vector<int>> all_weights(nr_species, vector<int>(nr_edges));
+  vector<int> from(nr_edges), to(nr_edges);
+  vector<int> all_weights(nr_species * nr_edges);  // species by species
 
   for (int i_edge = 0; i_edge < nr_edges; i_edge++) {
-    int t1, t2;
-    cin >> t1 >> t2;
-    edge_desc edge = boost::add_edge(t1, t2, G).first;
-    edges[i_edge] = edge;
-    for (int i_species = 0; i_species < nr_species; i_species++) {
-      int w;
-      cin >> w;
-      all_weights[i_species][i_edge] = w;
-    }
+    cin >> from[i_edge] >> to[i_edge];
+    for (int i_species = 0; i_species < nr_species; i_species++)
+      cin >> all_weights[i_species * nr_edges + i_edge];
   }
   vector<int> hives(nr_species);
   for (int i_species = 0; i_species < nr_species; i_species++) {
@@ -47,30 +46,36 @@ void solve() {
     hives[i_species] = h;
   }
 
-  // new main graph
-  weighted_graph G2(nr_trees);
-  weight_map weights2 = boost::get(boost::edge_weight, G2);
-
-  // calculate subgraph for all species and add to main graph
-  weight_map weights = boost::get(boost::edge_weight, G);
+  // minimum weight of every edge over all species MSTs containing it
+  vector<int> best(nr_edges, INT_MAX);
+  vector<int> order(nr_edges);
   for (int spe = 0; spe < nr_species; spe++) {
-    // adjust weights
-    for (int i = 0; i < nr_edges; i++) {
-      weights[edges[i]] = all_weights[spe][i];
-    }
+    const int *weights = &all_weights[spe * nr_edges];
+    iota(order.begin(), order.end(), 0);
+    sort(order.begin(), order.end(),
+         [&](int e1, int e2) { return weights[e1] < weights[e2]; });
 
-    // find all found edges
-    vector<edge_desc> spanning_edges;
-    boost::kruskal_minimum_spanning_tree(G, back_inserter(spanning_edges));
-
-    // add all edges to new graph
-    for (edge_desc ed : spanning_edges) {
-      edge_desc en =
-          boost::add_edge(boost::source(ed, G), boost::target(ed, G), G2).first;
-      weights2[en] = weights[ed];
+    boost::disjoint_sets_with_storage<> uf(nr_trees);
+    int nr_components = nr_trees;
+    for (int i = 0; i < nr_edges && nr_components > 1; i++) {
+      int e = order[i];
+      int c1 = uf.find_set(from[e]), c2 = uf.find_set(to[e]);
+      if (c1 == c2) continue;
+      uf.link(c1, c2);
+      nr_components--;
+      best[e] = min(best[e], weights[e]);
     }
   }
 
+  // new main graph, one edge per edge in any MST
+  weighted_graph G2(nr_trees);
+  weight_map weights2 = boost::get(boost::edge_weight, G2);
+  for (int i = 0; i < nr_edges; i++) {
+    if (best[i] == INT_MAX) continue;
+    edge_desc en = boost::add_edge(from[i], to[i], G2).first;
+    weights2[en] = best[i];
+  }
+
   // dijkstra
   vector<int> dist_map(nr_trees);
 
@@ -78,11 +83,12 @@ void solve() {
       G2, start,
       boost::distance_map(boost::make_iterator_property_map(
           dist_map.begin(), boost::get(boost::vertex_index, G2))));
-  cout << dist_map[end] << endl;
+  cout << dist_map[end] << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -2,12 +2,19 @@
 Given a set of characteristics for each student,
 construct a maximum matching with at least nr_min_common
 common characteristics.
+
+Characteristics are interned to ids with a hash map. Instead of a dense
+students x students matrix, we count the common characteristics of one student
+with all later students at a time, walking the student lists of its
+characteristics. Only the touched counters are reset afterwards.
 */
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/max_cardinality_matching.hpp>
+#include <algorithm>
 #include <iostream>
-#include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>
@@ -19,34 +26,38 @@ using namespace std;
 void solve() {
   int nr_students, nr_char, nr_min_common;
   cin >> nr_students >> nr_char >> nr_min_common;
-  map<string, vector<int>> chars;
+  unordered_map<string, int> char_ids;
+  vector<vector<int>> chars;  // students of every characteristic, ascending
+  vector<int> student_chars(nr_students * nr_char);
   string temp_char;
 
   for (int i_student = 0; i_student < nr_students; i_student++) {
     for (int i_char = 0; i_char < nr_char; i_char++) {
       cin >> temp_char;
-      auto it = chars.find(temp_char);
-      if (it == chars.end()) chars.insert(make_pair(temp_char, vector<int>()));
-      chars[temp_char].push_back(i_student);
-    }
-  }
-
-  // calculate nr of common characteristics between all students
-  vector<vector<int>> common(nr_students, vector<int>(nr_students));
-  for (auto const& [charac, v_students] : chars) {
-    for (int i_s1 = 0; i_s1 < (int)v_students.size(); i_s1++) {
-      for (int i_s2 = i_s1 + 1; i_s2 < (int)v_students.size(); i_s2++) {
-        common[v_students[i_s1]][v_students[i_s2]]++;
-      }
+      auto it = char_ids.emplace(temp_char, chars.size()).first;
+      if (it->second == (int)chars.size()) chars.emplace_back();
+      chars[it->second].push_back(i_student);
+      student_chars[i_student * nr_char + i_char] = it->second;
     }
   }
 
-  // construct a graph
+  // count common characteristics of s1 with every later student,
+  // and add an edge for the pairs with enough of them
   graph G(nr_students);
-  for (int i_s1 = 0; i_s1 < nr_students; i_s1++) {
-    for (int i_s2 = 0; i_s2 < nr_students; i_s2++) {
-      if (common[i_s1][i_s2] > nr_min_common) boost::add_edge(i_s1, i_s2, G);
+  vector<int> common(nr_students, 0), touched;
+  for (int s1 = 0; s1 < nr_students; s1++) {
+    for (int i_char = 0; i_char < nr_char; i_char++) {
+      int charac = student_chars[s1 * nr_char + i_char];
+      const vector<int> &v_students = chars[charac];
+      for (auto s2 = upper_bound(v_students.begin(), v_students.end(), s1);
+           s2 != v_students.end(); ++s2)
+        if (common[*s2]++ == 0) touched.push_back(*s2);
+    }
+    for (int s2 : touched) {
+      if (common[s2] > nr_min_common) boost::add_edge(s1, s2, G);
+      common[s2] = 0;
     }
+    touched.clear();
   }
 
   std::vector<vertex_desc> mate_map(nr_students);  // exterior property map
@@ -60,13 +71,14 @@ void solve() {
                                            boost::get(boost::vertex_index, G)));
 
   if (matching_size == nr_students / 2)
-    cout << "not optimal" << endl;
+    cout << "not optimal\n";
   else
-    cout << "optimal" << endl;
+    cout << "optimal\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -49,11 +49,12 @@ void solve() {
       boost::distance_map(boost::make_iterator_property_map(
           dist_map.begin(), boost::get(boost::vertex_index, G))));
 
-  cout << *max_element(dist_map.begin(), dist_map.end()) << endl;
+  cout << *max_element(dist_map.begin(), dist_map.end()) << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -3,75 +3,100 @@ Find the number of edges after which removal the graph is unconnected.
 These edges are in a BICONNECTED component with one edge.
 A vertex which belongs to MORE THAN 1 biconnected component is an
 ARTICULATION POINT (if removed from graph, the graph becomes unconnected).
+
+Instead of computing all biconnected components we find the bridges directly
+with Tarjan's low-link values: the edge from v to its DFS child w is a bridge
+if nothing in the subtree of w reaches v or above. The DFS uses an explicit
+stack over a CSR adjacency, so there is no recursion depth limit. Edges are
+skipped by id rather than by parent vertex, so parallel edges are no bridges.
+The bridges are put in order with two stable counting sort passes.
 */
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/biconnected_components.hpp>
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
-namespace boost {
-struct edge_component_t {
-  enum { num = 555 };
-  typedef edge_property_tag kind;
-} edge_component;
-}  // namespace boost
-
-typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS,
-                              boost::no_property,
-                              boost::property<boost::edge_component_t, size_t>>
-    graph;
-typedef boost::graph_traits<graph>::edge_iterator edge_it;
-
 using namespace std;
 
 void solve() {
   int n, m;
   cin >> n >> m;
 
-  graph G(n);
+  // neighbours of v are to[offset[v]] .. to[offset[v+1]-1], via edge edge_id[]
+  vector<int> from(m), dest(m), offset(n + 1, 0);
   for (int i = 0; i < m; i++) {
-    int i1, i2;
-    cin >> i1 >> i2;
-    boost::add_edge(i1, i2, G);
+    cin >> from[i] >> dest[i];
+    offset[from[i] + 1]++;
+    offset[dest[i] + 1]++;
+  }
+  for (int v = 0; v < n; v++) offset[v + 1] += offset[v];
+  vector<int> to(2 * m), edge_id(2 * m);
+  vector<int> fill(offset.begin(), offset.end() - 1);
+  for (int i = 0; i < m; i++) {
+    to[fill[from[i]]] = dest[i];
+    edge_id[fill[from[i]]++] = i;
+    to[fill[dest[i]]] = from[i];
+    edge_id[fill[dest[i]]++] = i;
   }
 
-  // get biconnected components
-  auto component = boost::get(boost::edge_component, G);
-  int component_nr = biconnected_components(G, component);
+  // iterative dfs computing discovery times and low-links
+  vector<int> disc(n, -1), low(n), next(n), parent_edge(n), stack;
+  vector<pair<int, int>> bridges;
+  int timer = 0;
+  for (int root = 0; root < n; root++) {
+    if (disc[root] != -1) continue;
+    disc[root] = low[root] = timer++;
+    parent_edge[root] = -1;
+    next[root] = offset[root];
+    stack.push_back(root);
 
-  // count number of edges in each component
-  edge_it ei, ei_end;
-  vector<int> edges_nr(component_nr);
-  for (boost::tie(ei, ei_end) = boost::edges(G); ei != ei_end; ++ei)
-    edges_nr[component[*ei]]++;
+    while (!stack.empty()) {
+      int v = stack.back();
+      if (next[v] < offset[v + 1]) {
+        int w = to[next[v]], id = edge_id[next[v]];
+        next[v]++;
+        if (id == parent_edge[v]) continue;
 
-  // iterate over edges, if edge is in a component with edge count one,
-  // it is an important bridge
-  int count = 0;
-  vector<pair<int, int>> edges;
-  for (boost::tie(ei, ei_end) = boost::edges(G); ei != ei_end; ++ei) {
-    if (edges_nr[component[*ei]] == 1) {
-      count++;
-      int s = boost::source(*ei, G), t = boost::target(*ei, G);
+        if (disc[w] == -1) {
+          disc[w] = low[w] = timer++;
+          parent_edge[w] = id;
+          next[w] = offset[w];
+          stack.push_back(w);
+        } else
+          low[v] = min(low[v], disc[w]);
+        continue;
+      }
 
-      if (s < t)
-        edges.push_back({s, t});
-      else
-        edges.push_back({t, s});
+      // v is finished, pass its low-link to the parent
+      stack.pop_back();
+      if (stack.empty()) continue;
+      int p = stack.back();
+      low[p] = min(low[p], low[v]);
+      if (low[v] > disc[p]) bridges.push_back({min(p, v), max(p, v)});
     }
   }
 
-  sort(edges.begin(), edges.end());
+  // sort by second vertex, then stable by first vertex
+  auto counting_sort = [&](auto key) {
+    vector<int> start(n + 1, 0);
+    for (auto &e : bridges) start[key(e) + 1]++;
+    for (int v = 0; v < n; v++) start[v + 1] += start[v];
+    vector<pair<int, int>> sorted(bridges.size());
+    for (auto &e : bridges) sorted[start[key(e)]++] = e;
+    bridges.swap(sorted);
+  };
+  counting_sort([](const pair<int, int> &e) { return e.second; });
+  counting_sort([](const pair<int, int> &e) { return e.first; });
 
-  cout << count << endl;
-  for (auto e : edges) cout << e.first << " " << e.second << endl;
+  cout << bridges.size() << "\n";
+  for (auto e : bridges) cout << e.first << " " << e.second << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
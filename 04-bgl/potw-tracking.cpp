@@ -4,71 +4,97 @@ Finding the shortest path using a minimum required number (k) of
 
 Trick: Duplicate the graph on k+1 levels and the only way
 to get to the next level is using a "special edge".
+
+The levels are not built explicitly: we keep one CSR copy of the roads and
+run Dijkstra on (city, level) states, deciding during relaxation which level a
+road leads to. Costs are small integers, so the priority queue is a ring of
+buckets, one per distance modulo (max cost + 1) (Dial's algorithm).
 */
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <algorithm>
+#include <climits>
 #include <iostream>
 #include <vector>
 
-typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS,
-                              boost::no_property,
-                              boost::property<boost::edge_weight_t, int>>
-    weighted_graph;
-typedef boost::property_map<weighted_graph, boost::edge_weight_t>::type
-    weight_map;
-typedef boost::graph_traits<weighted_graph>::edge_descriptor edge_desc;
-
 using namespace std;
 
+struct road {
+  int to, cost;
+  bool is_river;
+};
+
 void solve() {
   int nr_cities, nr_roads, min_rivers_used, start, end;
   cin >> nr_cities >> nr_roads >> min_rivers_used >> start >> end;
+  const int nr_levels = min_rivers_used + 1;
 
-  int nodes = nr_cities * (min_rivers_used + 1);
-  weighted_graph G(nodes);
-  weight_map weights = boost::get(boost::edge_weight, G);
-  edge_desc e;
-
+  // roads of city i are roads[offset[i]] .. roads[offset[i+1]-1], both ways
+  vector<int> city1(nr_roads), city2(nr_roads), cost(nr_roads);
+  vector<bool> is_river(nr_roads);
+  vector<int> offset(nr_cities + 1, 0);
+  int max_cost = 0;
+  for (int i = 0; i < nr_roads; i++) {
+    int river;
+    cin >> city1[i] >> city2[i] >> cost[i] >> river;
+    is_river[i] = river;
+    offset[city1[i] + 1]++;
+    offset[city2[i] + 1]++;
+    max_cost = max(max_cost, cost[i]);
+  }
+  for (int i = 0; i < nr_cities; i++) offset[i + 1] += offset[i];
+  vector<road> roads(2 * nr_roads);
+  vector<int> fill(offset.begin(), offset.end() - 1);
   for (int i = 0; i < nr_roads; i++) {
-    int city1, city2, cost, is_river;
-    cin >> city1 >> city2 >> cost >> is_river;
+    roads[fill[city1[i]]++] = {city2[i], cost[i], is_river[i]};
+    roads[fill[city2[i]]++] = {city1[i], cost[i], is_river[i]};
+  }
 
-    for (int i_level = 0; i_level <= min_rivers_used; i_level++) {
-      // use min_rivers_used + 1 levels,
-      // to ensure using at least the number of necessary rivers
-      int level = nr_cities * i_level;
+  // dijkstra on states city * nr_levels + level
+  vector<int> dist(nr_cities * nr_levels, INT_MAX);
+  vector<vector<int>> buckets(max_cost + 1);
+  const int target = end * nr_levels + min_rivers_used;
+  int pending = 1;
+  dist[start * nr_levels] = 0;
+  buckets[0].push_back(start * nr_levels);
 
-      // if is a normal road, connect the two cities on all levels
-      if (!is_river || i_level == min_rivers_used) {
-        e = boost::add_edge(city1 + level, city2 + level, G).first;
-        weights[e] = cost;
-      }
-      // if we have a river road and we're not on the last level
-      // add an edge from both cities to the other city on the upper level
-      if (is_river && i_level != min_rivers_used) {
-        e = boost::add_edge(city1 + level, city2 + level + nr_cities, G).first;
-        weights[e] = cost;
-        e = boost::add_edge(city1 + level + nr_cities, city2 + level, G).first;
-        weights[e] = cost;
+  auto relax = [&](int state, int d) {
+    if (d >= dist[state]) return;
+    dist[state] = d;
+    buckets[d % (max_cost + 1)].push_back(state);
+    pending++;
+  };
+
+  for (int d = 0; pending > 0 && dist[target] > d; d++) {
+    vector<int> &bucket = buckets[d % (max_cost + 1)];
+    while (!bucket.empty()) {
+      int state = bucket.back();
+      bucket.pop_back();
+      pending--;
+      if (dist[state] != d) continue;  // already reached with a shorter path
+
+      int city = state / nr_levels, level = state % nr_levels;
+      for (int i = offset[city]; i < offset[city + 1]; i++) {
+        const road &r = roads[i];
+        int next = r.to * nr_levels;
+        // normal roads, and rivers on the last level, stay on the level
+        if (!r.is_river || level == min_rivers_used)
+          relax(next + level, d + r.cost);
+        // a river leads to the other city one level up or down
+        if (r.is_river && level < min_rivers_used)
+          relax(next + level + 1, d + r.cost);
+        if (r.is_river && level > 0) relax(next + level - 1, d + r.cost);
       }
     }
   }
 
-  // run dijkstra to find shortest path
-  vector<int> dist_map(nodes);
-  boost::dijkstra_shortest_paths(
-      G, start,
-      boost::distance_map(boost::make_iterator_property_map(
-          dist_map.begin(), boost::get(boost::vertex_index, G))));
-  int top_level_end = end + nr_cities * min_rivers_used;
-  cout << dist_map[top_level_end] << endl;
+  cout << dist[target] << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
   return 0;
-}
\ No newline at end of file
+}
@@ -49,13 +49,14 @@ void solve() {
     if (additional[si] >= missing_d) result = si + 1;
   }
   if (result == -1 || curr_t_sum >= t_sum)
-    cout << "Panoramix captured" << endl;
+    cout << "Panoramix captured\n";
   else
-    cout << result << endl;
+    cout << result << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -107,11 +107,12 @@ void solve() {
     best = count_jedi_from(start, nr_segments, new_jedi);
   }
 
-  cout << best << endl;
+  cout << best << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -63,11 +63,12 @@ void solve() {
     }
   }
 
-  cout << nr << endl;
+  cout << nr << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
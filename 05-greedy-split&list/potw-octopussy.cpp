@@ -32,7 +32,7 @@ void solve() {
     explosion[left_index] = min(explosion[t] - 1, explosion[left_index]);
     explosion[right_index] = min(explosion[t] - 1, explosion[right_index]);
     if (explosion[left_index] <= 0 || explosion[right_index] <= 0) {
-      cout << "no" << endl;
+      cout << "no\n";
       return;
     }
   }
@@ -40,15 +40,16 @@ void solve() {
 
   for (int t = 1; t < n; t++)
     if (explosion[t - 1] < t) {
-      cout << "no" << endl;
+      cout << "no\n";
       return;
     }
 
-  cout << "yes" << endl;
+  cout << "yes\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -62,13 +62,14 @@ void solve() {
 
   int moves = precompute_scores(target_score, max_moves, canals);
   if (moves == -1)
-    cout << "Impossible" << endl;
+    cout << "Impossible\n";
   else
-    cout << moves << endl;
+    cout << moves << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -73,11 +73,12 @@ void solve() {
   }
 
   int flow = boost::push_relabel_max_flow(G, source, sink);
-  cout << (target_flow <= flow ? "yes" : "no") << endl;
+  cout << (target_flow <= flow ? "yes" : "no") << "\n";
 }
 
 int main() {
   std::ios_base::sync_with_stdio(false);
+  std::cin.tie(nullptr);
   int t;
   std::cin >> t;
   while (t--) solve();
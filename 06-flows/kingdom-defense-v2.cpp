@@ -93,11 +93,12 @@ void testcase() {
   }
 
   long flow = boost::push_relabel_max_flow(G, v_source, v_sink);
-  std::cout << (demanded_sum <= flow ? "yes" : "no") << std::endl;
+  std::cout << (demanded_sum <= flow ? "yes" : "no") << "\n";
 }
 
 int main() {
   std::ios_base::sync_with_stdio(false);
+  std::cin.tie(nullptr);
   int t;
   std::cin >> t;
   while (t--) testcase();
@@ -71,11 +71,12 @@ void solve() {
   }
 
   int flow = boost::push_relabel_max_flow(G, source, sink);
-  std::cout << flow << std::endl;
+  std::cout << flow << "\n";
 }
 
 int main() {
   std::ios_base::sync_with_stdio(false);
+  std::cin.tie(nullptr);
   int t;
   std::cin >> t;
   while (t--) solve();
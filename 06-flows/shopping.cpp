@@ -59,11 +59,12 @@ void solve() {
   }
 
   int flow = boost::push_relabel_max_flow(G, source, sink);
-  std::cout << (flow == nr_shops ? "yes" : "no") << std::endl;
+  std::cout << (flow == nr_shops ? "yes" : "no") << "\n";
 }
 
 int main() {
   std::ios_base::sync_with_stdio(false);
+  std::cin.tie(nullptr);
   int t;
   std::cin >> t;
   while (t--) solve();
@@ -43,7 +43,7 @@ void solve() {
     }
   }
   if (valid_count % 2 != 0) {
-    cout << "no" << endl;
+    cout << "no\n";
     return;
   }
 
@@ -56,11 +56,12 @@ void solve() {
       G, boost::make_iterator_property_map(mate_map.begin(),
                                            boost::get(boost::vertex_index, G)));
 
-  cout << (matching_size == valid_count / 2 ? "yes" : "no") << endl;
+  cout << (matching_size == valid_count / 2 ? "yes" : "no") << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -68,13 +68,14 @@ void solve(int nutrients_nr, int foods_nr) {
   Solution s = CGAL::solve_nonnegative_linear_program(lp, ET());
 
   if (s.is_optimal())
-    cout << double_to_floor(s.objective_value()) << endl;
+    cout << double_to_floor(s.objective_value()) << "\n";
   else if (s.is_infeasible())
-    cout << "No such diet." << endl;
+    cout << "No such diet.\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   while (true) {
     int n, m;
     cin >> n >> m;
@@ -54,16 +54,17 @@ void solve(int n) {
   Solution s = CGAL::solve_linear_program(lp, ET());
 
   if (s.is_infeasible())
-    cout << "none" << endl;
+    cout << "none\n";
   else if (s.is_unbounded())
-    cout << "inf" << endl;
+    cout << "inf\n";
   // since we changed the sign of objective function
   else
-    cout << floor(to_double((-s.objective_value()))) << endl;
+    cout << floor(to_double((-s.objective_value()))) << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   while (true) {
     int n;
     cin >> n;
@@ -60,11 +60,11 @@ void maximize() {
   Solution s = CGAL::solve_linear_program(lp, ET());
   
   if (s.is_optimal()) {
-    cout << -ceil(s.objective_value()) << endl;
+    cout << -ceil(s.objective_value()) << "\n";
   } else if (s.is_infeasible()) {
-    cout << "no" << endl;
+    cout << "no\n";
   } else if (s.is_unbounded()) {
-    cout << "unbounded" << endl;
+    cout << "unbounded\n";
   }
 }
 
@@ -107,16 +107,17 @@ void minimize() {
   Solution s = CGAL::solve_linear_program(lp, ET());
   
   if (s.is_optimal()) {
-    cout << ceil(s.objective_value()) << endl;
+    cout << ceil(s.objective_value()) << "\n";
   } else if (s.is_infeasible()) {
-    cout << "no" << endl;
+    cout << "no\n";
   } else if (s.is_unbounded()) {
-    cout << "unbounded" << endl;
+    cout << "unbounded\n";
   }
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
 
   while (true) {
     int p;
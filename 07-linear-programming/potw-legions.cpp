@@ -50,11 +50,12 @@ void solve() {
 
   // solution should always be feasible as asterix and panoramix are completely
   // surrounded
-  cout << double_to_floor(-s.objective_value()) << endl;
+  cout << double_to_floor(-s.objective_value()) << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
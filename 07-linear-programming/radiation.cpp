@@ -5,13 +5,18 @@ Remarks:
 - no measured cell on the boundary p = 0
     -> our cells lie on the negative side of -1 or positive side of 1
 - our combination of coefficients might be a big number -> double (long smaller)
+
+The LPs of different test cases share nothing, so main() solves them in parallel.
 */
 
 #include <CGAL/Gmpz.h>
 #include <CGAL/QP_functions.h>
 #include <CGAL/QP_models.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 typedef double IT;
@@ -83,32 +88,58 @@ bool try_separation(int degree, vector<coord> &A, vector<coord> &B) {
   return !s.is_infeasible();
 }
 
-void solve() {
+struct Cells {
+  vector<coord> healthy;
+  vector<coord> tumors;
+};
+
+Cells read_cells() {
   int nr_healthy, nr_tumor;
   cin >> nr_healthy >> nr_tumor;
 
-  vector<coord> healthy = read_coords(nr_healthy);
-  vector<coord> tumors = read_coords(nr_tumor);
+  Cells cells;
+  cells.healthy = read_coords(nr_healthy);
+  cells.tumors = read_coords(nr_tumor);
+  return cells;
+}
 
+// minimal separating degree, -1 if impossible
+int solve(Cells &cells) {
   // case when we only have one set of points - they're already separated
-  if (nr_healthy == 0 || nr_tumor == 0) {
-    cout << 0 << endl;
-    return;
-  }
+  if (cells.healthy.empty() || cells.tumors.empty()) return 0;
 
-  for (int degree = 1; degree <= 30; degree++) {
-    if (try_separation(degree, healthy, tumors)) {
-      cout << degree << endl;
-      return;
-    }
-  }
-  cout << "Impossible!" << endl;
+  for (int degree = 1; degree <= 30; degree++)
+    if (try_separation(degree, cells.healthy, cells.tumors)) return degree;
+  return -1;
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
-  while (t--) solve();
+
+  vector<Cells> tests(t);
+  for (auto &test : tests) test = read_cells();
+
+  // threads claim test cases through a shared counter, results keep input order
+  vector<int> results(t);
+  atomic<int> next_test(0);
+  auto worker = [&]() {
+    for (int i = next_test++; i < t; i = next_test++)
+      results[i] = solve(tests[i]);
+  };
+
+  int nr_threads = max(1u, thread::hardware_concurrency());
+  vector<thread> pool;
+  for (int i = 0; i < min(nr_threads, t); i++) pool.emplace_back(worker);
+  for (auto &th : pool) th.join();
+
+  for (int degree : results) {
+    if (degree == -1)
+      cout << "Impossible!\n";
+    else
+      cout << degree << "\n";
+  }
   return 0;
 }
\ No newline at end of file
@@ -7,6 +7,7 @@ Use triangulation to easily find the closest point to a random new point.
 #include <CGAL/squared_distance_2.h>  // to calculate euclidean distance
 
 #include <iostream>
+#include <string>
 #include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
@@ -27,6 +28,10 @@ void solve(int nr_restaurants) {
 
   int m;
   cin >> m;  // nr of possible locations
+
+  // collect all answers and write them at once
+  string answers;
+  answers.reserve(12 * m);
   for (int i = 0; i < m; i++) {
     int x, y;
     cin >> x >> y;
@@ -35,12 +40,15 @@ void solve(int nr_restaurants) {
     // calculate distance to nearest vertex (current location)
     Triangulation::Vertex_handle v = t.nearest_vertex(K::Point_2(x, y));
     long dist = CGAL::squared_distance(point, v->point());
-    cout << dist << endl;
+    answers += to_string(dist);
+    answers += '\n';
   }
+  cout << answers;
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   while (true) {
     int n;
     cin >> n;
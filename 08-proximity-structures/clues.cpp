@@ -15,6 +15,7 @@ Find if it's possible to talk with two radios in a network with 2 frequencies.
 #include <boost/pending/disjoint_sets.hpp>
 #include <iostream>
 #include <queue>
+#include <string>
 #include <vector>
 
 typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
@@ -121,12 +122,14 @@ void solve(int T) {
   bool no_interference = can_2_color(t, stations_nr, radius_sq, components);
 
   // for each set of locations, check if communication is routable
+  string answers;
+  answers.reserve(clues_nr + 1);
   while (clues_nr--) {
     int x1, y1, x2, y2;
     cin >> x1 >> y1 >> x2 >> y2;
 
     if (!no_interference) {
-      cout << "n";
+      answers += 'n';
       continue;
     }
 
@@ -135,7 +138,7 @@ void solve(int T) {
 
     long dist = CGAL::squared_distance(point1, point2);
     if (dist <= radius_sq) {
-      cout << "y";
+      answers += 'y';
       continue;
     }
 
@@ -149,13 +152,15 @@ void solve(int T) {
     bool reachable = dist1 <= radius_sq && dist2 <= radius_sq;
     bool same_component = components[v1->info()] == components[v2->info()];
 
-    cout << "ny"[reachable && same_component];
+    answers += "ny"[reachable && same_component];
   }
-  cout << endl;
+  answers += '\n';
+  cout << answers;
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve(t);
@@ -106,11 +106,12 @@ void solve(int nr_bacteria) {
   // moment in which the last bacterium dies
   int t3 = square_dist_to_time(death_time[n - 1]);
 
-  cout << t1 << " " << t2 << " " << t3 << endl;
+  cout << t1 << " " << t2 << " " << t3 << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   while (true) {
     int n;
     cin >> n;
@@ -28,6 +28,7 @@ compare the given radius to the maximum allowed disk radius.
 #include <algorithm>
 #include <iostream>
 #include <queue>
+#include <string>
 #include <vector>
 
 typedef int Index;
@@ -104,6 +105,8 @@ void solve(int n) {
 
   int nr_users;
   cin >> nr_users;
+  string answers;
+  answers.reserve(nr_users + 1);
   while (nr_users--) {
     int x, y;
     K::FT d;
@@ -114,19 +117,21 @@ void solve(int n) {
     // has to be far enough from closest vertex to have a valid start
     K::FT nearest = CGAL::squared_distance(p, t.nearest_vertex(p)->point());
     if (nearest < d)
-      cout << 'n';
+      answers += 'n';
     else if (t.is_infinite(fh))
-      cout << 'y';
+      answers += 'y';
     else {
       K::FT radius = escape_dist[fh->info()] / 4;
-      cout << "ny"[radius >= d];
+      answers += "ny"[radius >= d];
     }
   }
-  cout << endl;
+  answers += '\n';
+  cout << answers;
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int n;
   while (cin >> n && n != 0) solve(n);
   return 0;
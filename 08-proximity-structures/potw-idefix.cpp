@@ -94,11 +94,12 @@ void solve() {
       prev_bones = bones;
     }
   }
-  cout << count << " " << R << endl;
+  cout << count << " " << R << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -7,76 +7,178 @@ Min cut = max flow.
 - it takes too much time to test every combination of s and t (O(n2)),
 and it is enough to check all combinations where vertex 0 is included
 and where vertex 0 is not included.
+- even those 2n flows are too many for large sculptures. The Hao-Orlin
+algorithm finds the cheapest cut with vertex 0 on the source side in the time of
+a single push-relabel flow: it keeps the residual graph and labels, and after
+each phase moves the current sink into the source set and picks a new sink.
+Running it on the graph and on the reversed graph covers both sides of vertex 0.
+- n is at most 200, so residual capacities are kept in an adjacency matrix.
+
+Every sculpture is cut on its own, so they are spread over worker threads.
 */
 
 #include <algorithm>
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/push_relabel_max_flow.hpp>
-#include <boost/tuple/tuple.hpp>
+#include <atomic>
+#include <climits>
 #include <iostream>
-
-typedef boost::adjacency_list_traits<boost::vecS, boost::vecS, boost::directedS>
-    traits;
-typedef boost::adjacency_list<
-    boost::vecS, boost::vecS, boost::directedS, boost::no_property,
-    boost::property<
-        boost::edge_capacity_t, long,
-        boost::property<boost::edge_residual_capacity_t, long,
-                        boost::property<boost::edge_reverse_t,
-                                        traits::edge_descriptor> > > >
-    graph;
-typedef boost::graph_traits<graph>::edge_descriptor edge_desc;
-typedef boost::graph_traits<graph>::out_edge_iterator out_edge_it;
-
-class edge_adder {
-  graph &G;
-
- public:
-  explicit edge_adder(graph &G) : G(G) {}
-
-  void add_edge(int from, int to, long capacity) {
-    auto c_map = boost::get(boost::edge_capacity, G);
-    auto r_map = boost::get(boost::edge_reverse, G);
-    const edge_desc e = boost::add_edge(from, to, G).first;
-    const edge_desc rev_e = boost::add_edge(to, from, G).first;
-    c_map[e] = capacity;
-    c_map[rev_e] = 0;  // reverse edge has no capacity!
-    r_map[e] = rev_e;
-    r_map[rev_e] = e;
-  }
-};
+#include <thread>
+#include <tuple>
+#include <vector>
 
 using namespace std;
 
-void solve() {
+struct Sculptures {
+  int nr_sculptures;
+  vector<tuple<int, int, int>> limbs;
+};
+
+Sculptures read_sculptures() {
   int nr_sculptures, nr_limbs;
   cin >> nr_sculptures >> nr_limbs;
 
-  graph G(nr_sculptures);
-  edge_adder adder(G);
-
-  for (int i = 0; i < nr_limbs; i++) {
+  Sculptures s = {nr_sculptures, vector<tuple<int, int, int>>(nr_limbs)};
+  for (auto &limb : s.limbs) {
     int figure1, figure2, cost;
     cin >> figure1 >> figure2 >> cost;
-    adder.add_edge(figure1, figure2, cost);
+    limb = {figure1, figure2, cost};
   }
+  return s;
+}
+
+// cheapest cut (S, V \ S) over all S containing source
+long hao_orlin(vector<vector<long>> r, int source) {
+  const int n = r.size();
+  const int SOURCE_SET = -1, AWAKE = 0;  // dormant sets are numbered from 1
+
+  vector<long> excess(n, 0);
+  vector<int> label(n, 0), label_count(2 * n + 1, 0), where(n, AWAKE);
+  vector<vector<int>> dormant;  // stack of dormant sets
+  vector<int> active;
+
+  auto push = [&](int from, int to, long amount) {
+    r[from][to] -= amount;
+    r[to][from] += amount;
+    excess[from] -= amount;
+    if (excess[to] == 0 && amount > 0) active.push_back(to);
+    excess[to] += amount;
+  };
+  auto to_source_set = [&](int v) {
+    where[v] = SOURCE_SET;
+    label_count[label[v]]--;
+    for (int w = 0; w < n; w++)
+      if (where[w] != SOURCE_SET && r[v][w] > 0) push(v, w, r[v][w]);
+  };
+  auto make_dormant = [&](const vector<int> &set) {
+    dormant.push_back(set);
+    for (int w : set) {
+      where[w] = dormant.size();
+      label_count[label[w]]--;
+    }
+  };
+
+  label_count[0] = n;
+  to_source_set(source);
+
+  long min_cut = LONG_MAX;
+  for (int phase = 1; phase < n; phase++) {
+    // wake up the last dormant set if every non-source vertex is asleep
+    if (count(where.begin(), where.end(), AWAKE) == 0) {
+      for (int w : dormant.back()) {
+        where[w] = AWAKE;
+        label_count[label[w]]++;
+        if (excess[w] > 0) active.push_back(w);
+      }
+      dormant.pop_back();
+    }
+
+    // the sink is the awake vertex with the lowest label
+    int sink = -1;
+    for (int v = 0; v < n; v++)
+      if (where[v] == AWAKE && (sink == -1 || label[v] < label[sink])) sink = v;
+
+    while (!active.empty()) {
+      int v = active.back();
+      active.pop_back();
 
-  // test all vertices as the source and sink
-  int min_cut = nr_limbs * 1000;        // c max is 1000
-  for (int i = 0; i < nr_sculptures; i++) {  // n is max 200
-    // any other vertex but 0 would do as well
-    int f1 = boost::push_relabel_max_flow(G, 0, i);
-    int f2 = boost::push_relabel_max_flow(G, i, 0);
+      // discharge v while it stays awake
+      while (v != sink && where[v] == AWAKE && excess[v] > 0) {
+        int next = -1;
+        for (int w = 0; w < n && next == -1; w++)
+          if (where[w] == AWAKE && r[v][w] > 0 && label[v] == label[w] + 1)
+            next = w;
 
-    min_cut = min(min_cut, min(f1, f2));
+        if (next != -1) {
+          push(v, next, min(excess[v], r[v][next]));
+          continue;
+        }
+
+        // relabel. if v is alone on its label, nothing above can reach the sink
+        if (label_count[label[v]] == 1) {
+          vector<int> gap;
+          for (int w = 0; w < n; w++)
+            if (where[w] == AWAKE && label[w] >= label[v]) gap.push_back(w);
+          make_dormant(gap);
+          break;
+        }
+
+        int min_label = INT_MAX;
+        for (int w = 0; w < n; w++)
+          if (where[w] == AWAKE && r[v][w] > 0)
+            min_label = min(min_label, label[w]);
+
+        if (min_label == INT_MAX) {
+          make_dormant({v});
+          break;
+        }
+        label_count[label[v]]--;
+        label[v] = min_label + 1;
+        label_count[label[v]]++;
+      }
+    }
+
+    // every limb into the awake set is saturated, the rest is stuck at the sink
+    min_cut = min(min_cut, excess[sink]);
+    to_source_set(sink);
+  }
+  return min_cut;
+}
+
+int solve(const Sculptures &s) {
+  const int n = s.nr_sculptures;
+  vector<vector<long>> costs(n, vector<long>(n, 0));
+  vector<vector<long>> reversed(n, vector<long>(n, 0));
+
+  for (auto &limb : s.limbs) {
+    costs[get<0>(limb)][get<1>(limb)] += get<2>(limb);
+    reversed[get<1>(limb)][get<0>(limb)] += get<2>(limb);
   }
-  cout << min_cut << endl;
+
+  // vertex 0 either stays with the first owner or goes to the second one
+  return min(hao_orlin(costs, 0), hao_orlin(reversed, 0));
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
-  while (t--) solve();
+
+  vector<Sculptures> tests(t);
+  for (auto &test : tests) test = read_sculptures();
+
+  // sculptures are handed out one at a time through an atomic index
+  vector<int> results(t);
+  atomic<int> next_test(0);
+  auto worker = [&]() {
+    for (int i = next_test++; i < t; i = next_test++)
+      results[i] = solve(tests[i]);
+  };
+
+  int nr_threads = max(1u, thread::hardware_concurrency());
+  vector<thread> pool;
+  for (int i = 0; i < min(nr_threads, t); i++) pool.emplace_back(worker);
+  for (auto &th : pool) th.join();
+
+  for (int result : results) cout << result << "\n";
   return 0;
-}
\ No newline at end of file
+}
@@ -82,11 +82,12 @@ void solve() {
 
   // calculate correct prio sum
   int priority_sum = added * max_cost - min_cost;
-  cout << priority_sum << endl;
+  cout << priority_sum << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
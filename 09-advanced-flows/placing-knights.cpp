@@ -149,11 +149,12 @@ void solve() {
                           (!is_white(i, length) && !visited[i]);
     if (is_independent && valid[i]) maxIS++;
   }
-  cout << maxIS << endl;
+  cout << maxIS << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
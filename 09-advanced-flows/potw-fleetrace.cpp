@@ -94,11 +94,12 @@ void solve() {
     flow += c_map[*e] - rc_map[*e];
 
   int real_cost = flow * 50 - cost;
-  cout << real_cost << endl;
+  cout << real_cost << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -106,11 +106,12 @@ void solve() {
   // since for cost c we did 100 - c
   // now for real c_sum we have to do flow*100 - cost
   int real_cost = flow * 100 - cost;
-  cout << flow << " " << real_cost << endl;
+  cout << flow << " " << real_cost << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
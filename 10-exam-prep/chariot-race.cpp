@@ -77,7 +77,7 @@ void solve() {
 
   rec(0);
   pair<int, int> result = memo_noparent[0];
-  cout << min(result.first, result.second) << endl;
+  cout << min(result.first, result.second) << "\n";
 
   children.clear();
   parent.clear();
@@ -88,6 +88,7 @@ void solve() {
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
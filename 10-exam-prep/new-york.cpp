@@ -11,9 +11,8 @@ desired path length. For each new node, we check if the path is feasible
 
 Implementation details:
 * Passing newly constructed data structures while recursing is slow and requires
-too much memory, thus we have to pass on the reference while recursing or hold
-the data structures globally, and restore the data structures after processing a
-subtree.
+too much memory, thus we pass on a reference to the per-test-case data while
+recursing, and restore the data structures after processing a subtree.
 * We hold the temperatures of the current path in a multiset, to quickly
 access min and max values. This is also faster than using a map (2.2s v 2.47s).
 */
@@ -25,11 +24,13 @@ access min and max values. This is also faster than using a map (2.2s v 2.47s).
 
 using namespace std;
 
-int max_risk;
-int goal_length;
-vector<int> temps;
-vector<vector<int>> routes;
-set<int> result;
+struct Trip {
+  int max_risk;
+  int goal_length;
+  vector<int> temps;
+  vector<vector<int>> routes;
+  set<int> result;
+};
 
 int temp_diff(multiset<int> &temps) {
   const int &curr_min = *temps.begin();
@@ -37,7 +38,11 @@ int temp_diff(multiset<int> &temps) {
   return curr_max - curr_min;
 }
 
-void calc_feasible(int point, multiset<int> &curr_temps, vector<int> &path) {
+void calc_feasible(Trip &trip, int point, multiset<int> &curr_temps,
+                   vector<int> &path) {
+  const int goal_length = trip.goal_length;
+  const vector<int> &temps = trip.temps;
+
   // update path and temperatures
   const int &temp = temps[point];
   curr_temps.insert(temp);
@@ -53,11 +58,12 @@ void calc_feasible(int point, multiset<int> &curr_temps, vector<int> &path) {
 
   // check if feasible path
   int start = path[path.size() - length];
-  if (length == goal_length && temp_diff(curr_temps) <= max_risk)
-    result.insert(start);
+  if (length == goal_length && temp_diff(curr_temps) <= trip.max_risk)
+    trip.result.insert(start);
 
   // recurse for subtrees
-  for (int next : routes[point]) calc_feasible(next, curr_temps, path);
+  for (int next : trip.routes[point])
+    calc_feasible(trip, next, curr_temps, path);
 
   // delete current node from the end of path and temps
   curr_temps.erase(curr_temps.find(temp));
@@ -72,35 +78,33 @@ void calc_feasible(int point, multiset<int> &curr_temps, vector<int> &path) {
 
 void solve() {
   int nr_points;
-  cin >> nr_points >> goal_length >> max_risk;
+  Trip trip;
+  cin >> nr_points >> trip.goal_length >> trip.max_risk;
 
-  temps.resize(nr_points);
-  for (int i = 0; i < nr_points; i++) cin >> temps[i];
-  routes.resize(nr_points);
+  trip.temps.resize(nr_points);
+  for (int i = 0; i < nr_points; i++) cin >> trip.temps[i];
+  trip.routes.resize(nr_points);
   for (int i = 0; i < nr_points - 1; i++) {
     int from, to;
     cin >> from >> to;
-    routes[from].push_back(to);
+    trip.routes[from].push_back(to);
   }
 
   multiset<int> curr_temps;
   vector<int> path;
 
-  calc_feasible(0, curr_temps, path);
+  calc_feasible(trip, 0, curr_temps, path);
 
-  if (result.size() == 0)
+  if (trip.result.size() == 0)
     cout << "Abort mission";
   else
-    for (int point : result) cout << point << " ";
-  cout << endl;
-
-  result.clear();
-  temps.clear();
-  routes.clear();
+    for (int point : trip.result) cout << point << " ";
+  cout << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -75,11 +75,12 @@ void solve() {
   }
   int flow = boost::push_relabel_max_flow(G, source, sink);
   bool excess_money = positive_balance > flow;
-  cout << (excess_money ? "yes" : "no") << endl;
+  cout << (excess_money ? "yes" : "no") << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
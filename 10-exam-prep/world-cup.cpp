@@ -182,13 +182,14 @@ void solve() {
   // solve the program, using ET as the exact type
   Solution s = CGAL::solve_linear_program(lp, ET());
   if (s.is_optimal())
-    cout << int(floor(-CGAL::to_double(s.objective_value()) / 100)) << endl;
+    cout << int(floor(-CGAL::to_double(s.objective_value()) / 100)) << "\n";
   else
-    cout << "RIOT!" << endl;
+    cout << "RIOT!\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -125,11 +125,12 @@ void solve() {
     }
   }
 
-  cout << max_s_for_f0 << " " << max_f_for_s0 << endl;
+  cout << max_s_for_f0 << " " << max_f_for_s0 << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
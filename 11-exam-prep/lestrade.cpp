@@ -109,11 +109,12 @@ void solve() {
   Solution s = CGAL::solve_linear_program(lp, ET());
   // cout << "HL"[s.is_optimal() && s.objective_value() <= z] << endl; 2.648s
   cout << "HL"[s.is_optimal()]
-       << endl;  // with extra constraint for fee: 1.745s
+       << "\n";  // with extra constraint for fee: 1.745s
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -67,11 +67,12 @@ void solve() {
       min_non_mst_cost = min(min_non_mst_cost, cost);
     }
   }
-  cout << min_non_mst_cost << endl;
+  cout << min_non_mst_cost << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -1,7 +1,6 @@
 #include <algorithm>
 #include <iostream>
 #include <vector>
-#include <map>
 
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/successive_shortest_path_nonnegative_weights.hpp>
@@ -46,11 +45,8 @@ class edge_adder {
 void solve() {
   int nr_bookings, nr_stations;
   cin >> nr_bookings >> nr_stations;
-  // cout << nr_bookings << " " << nr_stations << endl;
   const int MAX_TIME = 100'000;
 
-  graph G(0);
-  edge_adder adder(G);
   long total_cars = 0;
   vector<int> station_cars(nr_stations);
   for (int i = 0; i < nr_stations; i++) {
@@ -58,57 +54,73 @@ void solve() {
     total_cars += station_cars[i];
   }
 
-  vector<map<long, long>> time_index(nr_stations);
-  while (nr_bookings--) {
-    int from, to, profit;
-    long t1, t2;
-    cin >> from >> to >> t1 >> t2 >> profit;
-    // cout << from << " " << to << " " << t1 << " " << t2 << endl;
-    from--;
-    to--;
-    if (time_index[from].find(t1) == time_index[from].end())
-      time_index[from].emplace(t1, boost::add_vertex(G));
-    if (time_index[to].find(t2) == time_index[to].end())
-      time_index[to].emplace(t2, boost::add_vertex(G));
-    long i_from = time_index[from].find(t1)->second;
-    long i_to = time_index[to].find(t2)->second;
-    // cout << (t2-t1) << " " << profit<<endl;
-    long cost = (t2 - t1) * 100 - profit;
-    adder.add_edge(i_from, i_to, 1, cost);
+  // every (station, time) pair is one event, encoded so that sorting orders
+  // events by station first and time second
+  auto event = [&](int station, long time) {
+    return station * (MAX_TIME + 1L) + time;
+  };
+  vector<int> from(nr_bookings), to(nr_bookings), profit(nr_bookings);
+  vector<long> t1(nr_bookings), t2(nr_bookings);
+  vector<long> events;
+  events.reserve(2 * nr_bookings);
+  for (int i = 0; i < nr_bookings; i++) {
+    cin >> from[i] >> to[i] >> t1[i] >> t2[i] >> profit[i];
+    from[i]--;
+    to[i]--;
+    events.push_back(event(from[i], t1[i]));
+    events.push_back(event(to[i], t2[i]));
   }
+  sort(events.begin(), events.end());
+  events.erase(unique(events.begin(), events.end()), events.end());
 
-  int v_source = boost::add_vertex(G), v_sink = boost::add_vertex(G);
+  // the vertex of an event is its index among the sorted distinct events
+  const int nr_events = events.size();
+  auto vertex = [&](long e) {
+    return lower_bound(events.begin(), events.end(), e) - events.begin();
+  };
 
-  for (int station = 0; station < nr_stations; station++) {
-    auto first = time_index[station].begin();
-    if (first == time_index[station].end()) {
-      adder.add_edge(v_source, v_sink, station_cars[station], MAX_TIME * 100);
-      continue;
-    }
-    auto last = time_index[station].rbegin();
-    adder.add_edge(v_source, first->second, station_cars[station],
-                   first->first * 100);
-    adder.add_edge(last->second, v_sink, total_cars,
-                   (MAX_TIME - last->first) * 100);
-    auto previous = time_index[station].begin();
-    for (auto t = ++time_index[station].begin(); t != time_index[station].end();
-         ++t) {
-      adder.add_edge(previous->second, t->second, total_cars,
-                     (t->first - previous->first) * 100);
-      previous = t;
-    }
+  graph G(nr_events + 2);
+  edge_adder adder(G);
+  int v_source = nr_events, v_sink = nr_events + 1;
+
+  for (int i = 0; i < nr_bookings; i++) {
+    long cost = (t2[i] - t1[i]) * 100 - profit[i];
+    adder.add_edge(vertex(event(from[i], t1[i])), vertex(event(to[i], t2[i])),
+                   1, cost);
   }
 
+  // chain the events of every station in one pass over the sorted events
+  vector<bool> has_events(nr_stations, false);
+  for (int i = 0; i < nr_events; i++) {
+    int station = events[i] / (MAX_TIME + 1);
+    long time = events[i] % (MAX_TIME + 1);
+    bool first = i == 0 || events[i - 1] / (MAX_TIME + 1) != station;
+    bool last = i == nr_events - 1 || events[i + 1] / (MAX_TIME + 1) != station;
+    has_events[station] = true;
+
+    if (first)
+      adder.add_edge(v_source, i, station_cars[station], time * 100);
+    if (last)
+      adder.add_edge(i, v_sink, total_cars, (MAX_TIME - time) * 100);
+    else
+      adder.add_edge(i, i + 1, total_cars,
+                     (events[i + 1] % (MAX_TIME + 1) - time) * 100);
+  }
+  for (int station = 0; station < nr_stations; station++)
+    if (!has_events[station])
+      adder.add_edge(v_source, v_sink, station_cars[station], MAX_TIME * 100);
+
   boost::successive_shortest_path_nonnegative_weights(G, v_source, v_sink);
   long cost = boost::find_flow_cost(G);
 
   long total_extra_cost = total_cars * MAX_TIME * 100;
-  long profit = total_extra_cost - cost;
-  cout << profit << endl;
+  long profit_sum = total_extra_cost - cost;
+  cout << profit_sum << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
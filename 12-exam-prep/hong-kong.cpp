@@ -103,11 +103,12 @@ void solve() {
 
     cout << "ny"[far_enough_from_tree && path_to_valid_start];
   }
-  cout << endl;
+  cout << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
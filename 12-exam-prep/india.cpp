@@ -1,7 +1,19 @@
+/*
+Find the maximal number of elephants that can travel from the start to the end
+city without exceeding the budget.
+
+Successive shortest paths send flow along paths of nondecreasing cost per unit.
+Instead of searching over the flow value and solving a min cost flow from
+scratch for every probe, we augment one cheapest path at a time and stop at the
+first path we can no longer fully pay for, sending as many units along it as
+the remaining budget allows.
+*/
+
 #include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/successive_shortest_path_nonnegative_weights.hpp>
-#include <boost/graph/find_flow_cost.hpp>
+#include <climits>
 #include <iostream>
+#include <queue>
+#include <vector>
 
 typedef boost::adjacency_list_traits<boost::vecS, boost::vecS, boost::directedS> traits;
 typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS, boost::no_property,
@@ -38,55 +50,94 @@ class edge_adder {
 
 using namespace std;
 
-int get_cost(graph &G, edge_desc &e, int flow, int source, int sink) {
+// maximal flow from source to sink with total cost at most budget
+long max_flow_under_budget(graph &G, int source, int sink, long budget) {
   auto c_map = boost::get(boost::edge_capacity, G);
-  c_map[e] = flow;
-  boost::successive_shortest_path_nonnegative_weights(G, source, sink);
-  return boost::find_flow_cost(G);
+  auto rc_map = boost::get(boost::edge_residual_capacity, G);
+  auto r_map = boost::get(boost::edge_reverse, G);
+  auto w_map = boost::get(boost::edge_weight, G);
+
+  const int n = boost::num_vertices(G);
+  boost::graph_traits<graph>::edge_iterator e_beg, e_end;
+  for (boost::tie(e_beg, e_end) = boost::edges(G); e_beg != e_end; ++e_beg)
+    rc_map[*e_beg] = c_map[*e_beg];
+
+  // costs are nonnegative, so the potentials can start at 0
+  vector<long> potential(n, 0);
+  long flow = 0, cost = 0;
+
+  while (true) {
+    // dijkstra on reduced costs in the residual graph
+    vector<long> dist(n, LONG_MAX);
+    vector<edge_desc> pred(n);
+    priority_queue<pair<long, int>, vector<pair<long, int>>,
+                   greater<pair<long, int>>>
+        Q;
+    dist[source] = 0;
+    Q.push({0, source});
+    while (!Q.empty()) {
+      long d = Q.top().first;
+      int u = Q.top().second;
+      Q.pop();
+      if (d > dist[u]) continue;
+
+      out_edge_it oe_beg, oe_end;
+      for (boost::tie(oe_beg, oe_end) = boost::out_edges(u, G); oe_beg != oe_end;
+           ++oe_beg) {
+        if (rc_map[*oe_beg] == 0) continue;
+        int v = boost::target(*oe_beg, G);
+        long nd = d + w_map[*oe_beg] + potential[u] - potential[v];
+        if (nd < dist[v]) {
+          dist[v] = nd;
+          pred[v] = *oe_beg;
+          Q.push({nd, v});
+        }
+      }
+    }
+    if (dist[sink] == LONG_MAX) break;
+
+    for (int v = 0; v < n; v++)
+      if (dist[v] != LONG_MAX) potential[v] += dist[v];
+    const long unit_cost = potential[sink] - potential[source];
+
+    long bottleneck = LONG_MAX;
+    for (int v = sink; v != source; v = boost::source(pred[v], G))
+      bottleneck = min(bottleneck, rc_map[pred[v]]);
+
+    // path costs only grow, so a partially paid path is the last one
+    long units = bottleneck;
+    if (unit_cost > 0) units = min(units, (budget - cost) / unit_cost);
+
+    for (int v = sink; v != source; v = boost::source(pred[v], G)) {
+      rc_map[pred[v]] -= units;
+      rc_map[r_map[pred[v]]] += units;
+    }
+    flow += units;
+    cost += units * unit_cost;
+    if (units < bottleneck) break;
+  }
+  return flow;
 }
 
 void solve() {
   int nr_cities, nr_guides, budget, v_start, v_end;
   cin >> nr_cities >> nr_guides >> budget >> v_start >> v_end;
 
-  graph G(nr_cities + 1);
+  graph G(nr_cities);
   edge_adder adder(G);
-  int start_flow = 0, end_flow = 0;
 
   while (nr_guides--) {
     int from, to, cost, capacity;
     cin >> from >> to >> cost >> capacity;
     adder.add_edge(from, to, capacity, cost);
-    if (from == v_start) start_flow += capacity;
-    if (to == v_end) end_flow += capacity;
   }
 
-  int low = 0, high = min(start_flow, end_flow);
-
-  // add control edge and check if high is more than actual flow
-  int v_source = nr_cities;
-  edge_desc control = adder.add_edge(v_source, v_start, high, 0);
-  boost::successive_shortest_path_nonnegative_weights(G, v_source, v_end);
-  auto c_map = boost::get(boost::edge_capacity, G);
-  auto rc_map = boost::get(boost::edge_residual_capacity, G);
-  const int f = c_map[control] - rc_map[control];
-  high = min(high, f);
-
-  // binary search to find max flow which is under budget
-  while (low != high) {
-    int mid = (high + low + 1) / 2;
-    int mid_cost = get_cost(G, control, mid, v_source, v_end);
-
-    if (mid_cost > budget)
-      high = mid - 1;
-    else
-      low = mid;
-  }
-  cout << low << endl;
+  cout << max_flow_under_budget(G, v_start, v_end, budget) << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -35,7 +35,7 @@ void solve() {
   sort(max_weight.begin(), max_weight.end(), greater<int>());
   sort(box_weight.begin(), box_weight.end(), greater<int>());
   if (box_weight[0] > max_weight[0]) {
-    cout << "impossible" << endl;
+    cout << "impossible\n";
     return;
   }
 
@@ -50,11 +50,12 @@ void solve() {
   }
 
   long time_taken = low * 3 - 1;
-  cout << time_taken << endl;
+  cout << time_taken << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
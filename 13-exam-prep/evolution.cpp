@@ -15,22 +15,24 @@ knowing the path we took to the node.
 
 using namespace std;
 
-vector<vector<pair<int, int>>> queries;
-vector<vector<int>> children;
-vector<int> result;
-vector<int> ages;
-
-void dfs(int node, vector<int> &path) {
+struct Tree {
+  vector<vector<pair<int, int>>> queries;
+  vector<vector<int>> children;
+  vector<int> result;
+  vector<int> ages;
+};
+
+void dfs(Tree &tree, int node, vector<int> &path) {
   path.push_back(node);
 
   int pi = 0;
-  for (auto &q : queries[node]) {
-    while (ages[path[pi++]] > q.first) {
+  for (auto &q : tree.queries[node]) {
+    while (tree.ages[path[pi++]] > q.first) {
     }
-    result[q.second] = path[--pi];
+    tree.result[q.second] = path[--pi];
   }
 
-  for (int child : children[node]) dfs(child, path);
+  for (int child : tree.children[node]) dfs(tree, child, path);
 
   path.erase(path.end() - 1);
 }
@@ -39,10 +41,11 @@ void solve() {
   int n, q;
   cin >> n >> q;
 
-  ages = vector<int>(n);
-  result = vector<int>(q);
-  children = vector<vector<int>>(n);
-  queries = vector<vector<pair<int, int>>>(n);
+  Tree tree;
+  tree.ages = vector<int>(n);
+  tree.result = vector<int>(q);
+  tree.children = vector<vector<int>>(n);
+  tree.queries = vector<vector<pair<int, int>>>(n);
 
   map<string, int> idx;
   vector<string> names(n);
@@ -54,7 +57,7 @@ void solve() {
     cin >> n >> a;
     idx[n] = i;
     names[i] = n;
-    ages[i] = a;
+    tree.ages[i] = a;
     if (a > max_age) {
       max_age = a;
       start_node = i;
@@ -63,30 +66,31 @@ void solve() {
   string child, parent;
   for (int i = 0; i < n - 1; i++) {
     cin >> child >> parent;
-    children[idx[parent]].push_back(idx[child]);
+    tree.children[idx[parent]].push_back(idx[child]);
   }
 
   for (int i = 0; i < q; i++) {
     string n;
     int max_age;
     cin >> n >> max_age;
-    queries[idx[n]].push_back({max_age, i});
+    tree.queries[idx[n]].push_back({max_age, i});
   }
 
-  for (auto &qv : queries) {
+  for (auto &qv : tree.queries) {
     sort(begin(qv), end(qv),
          [](const auto q1, const auto q2) { return q1.first > q2.first; });
   }
 
   vector<int> path;
-  dfs(start_node, path);
+  dfs(tree, start_node, path);
 
-  for (int i : result) cout << names[i] << " ";
-  cout << endl;
+  for (int i : tree.result) cout << names[i] << " ";
+  cout << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
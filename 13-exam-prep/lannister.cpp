@@ -139,8 +139,9 @@ string solve() {
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
-  while (t--) cout << solve() << endl;
+  while (t--) cout << solve() << "\n";
   return 0;
 }
\ No newline at end of file
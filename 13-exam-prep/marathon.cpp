@@ -91,11 +91,12 @@ void solve() {
       adder.add_edge(to, from, capacities[*e_beg]);
   }
   long flow = boost::push_relabel_max_flow(G, s, f);
-  cout << flow << endl;
+  cout << flow << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -73,11 +73,12 @@ void solve() {
     }
   }
   state best = dp[n][k];
-  cout << best.price << " " << best.bevs << endl;
+  cout << best.price << " " << best.bevs << "\n";
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
   while (t--) solve();
@@ -10,6 +10,8 @@ Since we do not have a straightforward way to find the maximal number of
 Rebel planets, we run binary search and calculate the number of Rebel planets,
 given a goal N. If the max number is at least N, we set the search floor at.
 If the max number is less than N, we cap the new search ceiling with N-1.
+
+The galaxies are searched concurrently once all of them have been read.
 */
 #include <CGAL/Delaunay_triangulation_2.h>
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
@@ -17,8 +19,10 @@ If the max number is less than N, we cap the new search ceiling with N-1.
 #include <CGAL/Triangulation_vertex_base_with_info_2.h>
 
 #include <algorithm>
+#include <atomic>
 #include <boost/pending/disjoint_sets.hpp>
 #include <iostream>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -74,38 +78,62 @@ bool max_planets(int nr_empire, const vector<Point>& planets, const K::FT& rr) {
   return max_comp >= nr_empire;
 }
 
-void solve() {
+struct Galaxy {
+  vector<Point> planets;
+  K::FT rr;
+};
+
+Galaxy read_galaxy() {
   Index nr_planets;
   K::FT r;
   cin >> nr_planets >> r;
-  K::FT rr = r * r;
 
-  vector<Point> planets(nr_planets);
+  Galaxy g = {vector<Point>(nr_planets), r * r};
   for (Index i = 0; i < nr_planets; i++) {
     long x, y;
     cin >> x >> y;
-    planets[i] = {K::Point_2(x, y), i};
+    g.planets[i] = {K::Point_2(x, y), i};
   }
+  return g;
+}
 
-  int low = 1, high = nr_planets / 2;
+int solve(const Galaxy &g) {
+  int low = 1, high = g.planets.size() / 2;
 
   while (low != high) {
     int mid = (low + high + 1) / 2;
-    bool success = max_planets(mid, planets, rr);
+    bool success = max_planets(mid, g.planets, g.rr);
     if (success) {
       low = mid;
     } else {
       high = mid - 1;
     }
   }
-
-  cout << low << endl;
+  return low;
 }
 
 int main() {
   ios_base::sync_with_stdio(false);
+  cin.tie(nullptr);
   int t;
   cin >> t;
-  while (t--) solve();
+
+  vector<Galaxy> tests(t);
+  for (auto &test : tests) test = read_galaxy();
+
+  // each thread keeps grabbing the next galaxy until all are searched
+  vector<int> results(t);
+  atomic<int> next_test(0);
+  auto worker = [&]() {
+    for (int i = next_test++; i < t; i = next_test++)
+      results[i] = solve(tests[i]);
+  };
+
+  int nr_threads = max(1u, thread::hardware_concurrency());
+  vector<thread> pool;
+  for (int i = 0; i < min(nr_threads, t); i++) pool.emplace_back(worker);
+  for (auto &th : pool) th.join();
+
+  for (int result : results) cout << result << "\n";
   return 0;
 }
\ No newline at end of file